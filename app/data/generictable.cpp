@@ -35,14 +35,18 @@ GenericTable<T>::GenericTable()
 
 template <class T>
 GenericTable<T>::GenericTable(GenericTable<T> &&o)
-    : m_list(o.m_list)
+    : m_list(o.m_list),
+      m_indexIsValid(o.m_indexIsValid),
+      m_idIndex(o.m_idIndex)
 {
 
 }
 
 template <class T>
 GenericTable<T>::GenericTable(const GenericTable<T> &o)
-    : m_list(o.m_list)
+    : m_list(o.m_list),
+      m_indexIsValid(o.m_indexIsValid),
+      m_idIndex(o.m_idIndex)
 {
 
 }
@@ -52,6 +56,8 @@ template <class T>
 GenericTable<T> &GenericTable<T>::operator=(const GenericTable<T> &rhs)
 {
     m_list = rhs.m_list;
+    m_indexIsValid = rhs.m_indexIsValid;
+    m_idIndex = rhs.m_idIndex;
 
     return (*this);
 }
@@ -60,6 +66,8 @@ template <class T>
 GenericTable<T> &GenericTable<T>::operator=(GenericTable<T> &&rhs)
 {
     m_list = rhs.m_list;
+    m_indexIsValid = rhs.m_indexIsValid;
+    m_idIndex = rhs.m_idIndex;
     return (*this);
 }
 
@@ -68,6 +76,11 @@ GenericTable<T> &GenericTable<T>::operator<<(const T &rhs)
 {
     if (!rhs.id.isEmpty()) {
         m_list << rhs;
+
+        //! appending does not move any existing rows, so the index can be updated in place
+        if (m_indexIsValid && !m_idIndex.contains(rhs.id)) {
+            m_idIndex[rhs.id] = m_list.count() - 1;
+        }
     }
 
     return (*this);
@@ -77,6 +90,7 @@ template <class T>
 GenericTable<T> &GenericTable<T>::operator<<(const GenericTable<T> &rhs)
 {
     m_list << rhs.m_list;
+    invalidateIndex();
     return (*this);
 }
 
@@ -84,6 +98,7 @@ template <class T>
 GenericTable<T> &GenericTable<T>::insert(const int &pos, const T &rhs)
 {
     m_list.insert(pos, rhs);
+    invalidateIndex();
     return (*this);
 }
 
@@ -110,10 +125,14 @@ bool GenericTable<T>::operator==(const GenericTable<T> &rhs) const
         return false;
     }
 
+    updateIndex();
+
     for(int i=0; i<m_list.count(); ++i) {
-        QString id = m_list[i].id;
+        const QString &id = m_list[i].id;
+        const int rhsPos = rhs.indexOf(id);
 
-        if (!rhs.containsId(id) || (*this)[id] != rhs[id]){
+        //! duplicate ids are resolved to their first record, same as operator[]
+        if (rhsPos < 0 || m_list[m_idIndex.value(id)] != rhs.m_list[rhsPos]){
             return false;
         }
     }
@@ -130,14 +149,7 @@ bool GenericTable<T>::operator!=(const GenericTable<T> &rhs) const
 template <class T>
 T &GenericTable<T>::operator[](const QString &id)
 {
-    int pos{-1};
-
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            pos = i;
-            break;
-        }
-    }
+    int pos = indexOf(id);
 
     return m_list[pos];
 }
@@ -145,14 +157,7 @@ T &GenericTable<T>::operator[](const QString &id)
 template <class T>
 const T GenericTable<T>::operator[](const QString &id) const
 {
-    int pos{-1};
-
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            pos = i;
-            break;
-        }
-    }
+    int pos = indexOf(id);
 
     return m_list[pos];
 }
@@ -172,20 +177,15 @@ const T GenericTable<T>::operator[](const uint &index) const
 template <class T>
 bool GenericTable<T>::containsId(const QString &id) const
 {
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            return true;
-        }
-    }
-
-    return false;
+    updateIndex();
+    return m_idIndex.contains(id);
 }
 
 template <class T>
 bool GenericTable<T>::containsName(const QString &name) const
 {
     for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].name == name){
+        if (m_list[i].name == name) {
             return true;
         }
     }
@@ -202,13 +202,12 @@ bool GenericTable<T>::rowExists(const int &row) const
 template <class T>
 int GenericTable<T>::indexOf(const QString &id) const
 {
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            return i;
-        }
-    }
+    updateIndex();
+    const int pos = m_idIndex.value(id, -1);
 
-    return -1;
+    Q_ASSERT_X(pos < 0 || m_list[pos].id == id, "GenericTable::indexOf", "record id was changed without setId()");
+
+    return pos;
 }
 
 template <class T>
@@ -252,7 +251,7 @@ int GenericTable<T>::sortedPosForName(const QString &name) const
 template <class T>
 QString GenericTable<T>::idForName(const QString &name) const
 {
-    for(int  i=0; i<m_list.count(); ++i) {
+    for(int i=0; i<m_list.count(); ++i) {
         if (m_list[i].name == name) {
             return m_list[i].id;
         }
@@ -273,10 +272,23 @@ QStringList GenericTable<T>::names() const
     return nms;
 }
 
+template <class T>
+void GenericTable<T>::setId(const int &row, const QString &id)
+{
+    if (!rowExists(row) || m_list[row].id == id) {
+        return;
+    }
+
+    m_list[row].id = id;
+    invalidateIndex();
+}
+
 template <class T>
 void GenericTable<T>::clear()
 {
     m_list.clear();
+    m_idIndex.clear();
+    m_indexIsValid = true;
 }
 
 template <class T>
@@ -286,6 +298,7 @@ void GenericTable<T>::remove(const QString &id)
 
     if (pos >= 0) {
         m_list.removeAt(pos);
+        invalidateIndex();
     }
 }
 
@@ -294,9 +307,34 @@ void GenericTable<T>::remove(const int &row)
 {
     if (rowExists(row)) {
         m_list.removeAt(row);
+        invalidateIndex();
     }
 }
 
+template <class T>
+void GenericTable<T>::invalidateIndex()
+{
+    m_indexIsValid = false;
+}
+
+template <class T>
+void GenericTable<T>::updateIndex() const
+{
+    if (m_indexIsValid) {
+        return;
+    }
+
+    m_idIndex.clear();
+    m_idIndex.reserve(m_list.count());
+
+    //! first record wins for duplicate ids, same as the previous linear lookups
+    for(int i=m_list.count()-1; i>=0; --i) {
+        m_idIndex[m_list[i].id] = i;
+    }
+
+    m_indexIsValid = true;
+}
+
 //! Make linker happy and provide which table instances will be used.
 //! The alternative would be to move functions definitions in the header file
 //! but that would drop readability
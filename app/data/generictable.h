@@ -25,6 +25,7 @@
 #include "genericdata.h"
 
 // Qt
+#include <QHash>
 #include <QList>
 
 namespace Latte {
@@ -68,14 +69,29 @@ public:
 
     QStringList names() const;
 
+    //! ids must be changed only through this method in order for the id index to remain valid
+    void setId(const int &row, const QString &id);
+
     void clear();
     void remove(const int &row);
     void remove(const QString &id);
 
+protected:
+    //! the id index must be invalidated whenever rows of m_list are added, removed or moved directly
+    void invalidateIndex();
+
 protected:
     //! #id, record
     QList<T> m_list;
 
+private:
+    void updateIndex() const;
+
+private:
+    //! id -> row, lookup index that is rebuilt lazily when invalidated. Names are
+    //! not indexed because they are edited in place through records references
+    mutable bool m_indexIsValid{true};
+    mutable QHash<QString, int> m_idIndex;
 };
 
 }
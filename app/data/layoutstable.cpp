@@ -45,13 +45,13 @@ LayoutsTable::LayoutsTable(const LayoutsTable &o)
 //! Operators
 LayoutsTable &LayoutsTable::operator=(const LayoutsTable &rhs)
 {
-    m_list = rhs.m_list;
+    GenericTable<Layout>::operator=(rhs);
     return (*this);
 }
 
 LayoutsTable &LayoutsTable::operator=(LayoutsTable &&rhs)
 {
-    m_list = rhs.m_list;
+    GenericTable<Layout>::operator=(rhs);
     return (*this);
 }
 
@@ -72,6 +72,9 @@ void GenericLayout::unloadContainments()
              << " ,latteViews in memory ::: " << m_latteViews.size()
              << " ,hidden latteViews in memory :::  " << m_waitingLatteViews.size();
 
+    //! delayed syncs of the layout file must be written while its containments still exist
+    Layouts::Storage::self()->syncPendingLayoutFiles(file());
+
     for (const auto view : m_latteViews) {
         view->disconnectSensitiveSignals();
     }
@@ -1041,7 +1044,7 @@ void GenericLayout::assignToLayout(Latte::View *latteView, QList<Plasma::Contain
 
     //! sync the original layout file for integrity
     if (m_corona && m_corona->layoutsManager()->memoryUsage() == MemoryUsage::MultipleLayouts) {
-        Layouts::Storage::self()->syncToLayoutFile(this, false);
+        Layouts::Storage::self()->scheduleSyncToLayoutFile(this);
     }
 }
 
@@ -1079,7 +1082,7 @@ QList<Plasma::Containment *> GenericLayout::unassignFromLayout(Latte::View *latt
 
     //! sync the original layout file for integrity
     if (m_corona && m_corona->layoutsManager()->memoryUsage() == MemoryUsage::MultipleLayouts) {
-        Layouts::Storage::self()->syncToLayoutFile(this, false);
+        Layouts::Storage::self()->scheduleSyncToLayoutFile(this);
     }
 
     return containments;
@@ -25,9 +25,11 @@
 #include "../lattecorona.h"
 #include "../screenpool.h"
 #include "../layout/abstractlayout.h"
+#include "../layout/genericlayout.h"
 #include "../view/view.h"
 
 // Qt
+#include <QCoreApplication>
 #include <QDebug>
 #include <QDir>
 #include <QFile>
@@ -61,6 +63,19 @@ Storage::Storage()
     m_subIdentities << SubContaimentIdentityData{.cfgGroup="Configuration", .cfgProperty="SystrayContainmentId"};
     //! Group applet
     m_subIdentities << SubContaimentIdentityData{.cfgGroup="Configuration", .cfgProperty="ContainmentId"};
+
+    m_syncTimer.setSingleShot(true);
+    m_syncTimer.setInterval(1000);
+    QObject::connect(&m_syncTimer, &QTimer::timeout, [this]() {
+        syncPendingLayoutFiles();
+    });
+
+    if (qApp) {
+        //! delayed syncs must reach the layout files before the application exits
+        QObject::connect(qApp, &QCoreApplication::aboutToQuit, &m_syncTimer, [this]() {
+            syncPendingLayoutFiles();
+        });
+    }
 }
 
 Storage::~Storage()
@@ -247,7 +262,11 @@ void Storage::importToCorona(const Layout::GenericLayout *layout)
     if (copyFile.exists())
         copyFile.remove();
 
+    //! delayed writes must be part of the imported file
+    syncPendingLayoutFiles(layout->file());
+
     layoutOriginalFile.copy(tempLayoutFilePath);
+    invalidateSnapshot(tempLayoutFilePath);
 
     KSharedConfigPtr filePtr = KSharedConfig::openConfig(tempLayoutFilePath);
     KSharedConfigPtr newFile = KSharedConfig::openConfig(temp1FilePath);
@@ -257,6 +276,7 @@ void Storage::importToCorona(const Layout::GenericLayout *layout)
     current_containments.copyTo(&copyGroup);
 
     copyGroup.sync();
+    invalidateSnapshot(temp1FilePath);
 
     //! update ids to unique ones
     QString temp2File = newUniqueIdsLayoutFromFile(layout, temp1FilePath);
@@ -449,6 +469,7 @@ QString Storage::newUniqueIdsLayoutFromFile(const Layout::GenericLayout *layout,
     }
 
     investigate_conts.sync();
+    invalidateSnapshot(file);
 
     //! Copy To Temp 2 File And Update Correctly The Ids
     KSharedConfigPtr file2Ptr = KSharedConfig::openConfig(tempFile);
@@ -472,38 +493,151 @@ QString Storage::newUniqueIdsLayoutFromFile(const Layout::GenericLayout *layout,
     }
 
     fixedNewContainmets.sync();
+    invalidateSnapshot(tempFile);
 
     return tempFile;
 }
 
+bool Storage::groupsDiffer(const KConfigGroup &source, const KConfigGroup &target, const QStringList &ignoredKeys) const
+{
+    QStringList sourceKeys = source.keyList();
+    QStringList targetKeys = target.keyList();
+
+    for (const auto &key : ignoredKeys) {
+        sourceKeys.removeAll(key);
+        targetKeys.removeAll(key);
+    }
+
+    if (sourceKeys.count() != targetKeys.count()) {
+        return true;
+    }
+
+    for (const auto &key : sourceKeys) {
+        if (!target.hasKey(key) || target.readEntry(key, QString()) != source.readEntry(key, QString())) {
+            return true;
+        }
+    }
+
+    const QStringList sourceGroups = source.groupList();
+
+    if (sourceGroups.count() != target.groupList().count()) {
+        return true;
+    }
+
+    for (const auto &group : sourceGroups) {
+        if (!target.hasGroup(group) || groupsDiffer(source.group(group), target.group(group))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void Storage::syncToLayoutFile(const Layout::GenericLayout *layout, bool removeLayoutId)
 {
+    //! an immediate sync makes any delayed one for the same layout obsolete
+    for (int i = m_pendingSyncLayouts.count() - 1; i >= 0; --i) {
+        if (!m_pendingSyncLayouts[i] || m_pendingSyncLayouts[i].data() == layout) {
+            m_pendingSyncLayouts.removeAt(i);
+        }
+    }
+
+    if (m_pendingSyncLayouts.isEmpty()) {
+        m_syncTimer.stop();
+    }
+
     if (!layout->corona() || !isWritable(layout)) {
         return;
     }
 
     KSharedConfigPtr filePtr = KSharedConfig::openConfig(layout->file());
 
-    KConfigGroup oldContainments = KConfigGroup(filePtr, "Containments");
-    oldContainments.deleteGroup();
+    KConfigGroup fileContainments = KConfigGroup(filePtr, "Containments");
 
     qDebug() << " LAYOUT :: " << layout->name() << " is syncing its original file.";
 
+    QStringList syncedIds;
+    int updatedGroups{0};
+
     for (const auto containment : *layout->containments()) {
         if (removeLayoutId) {
             containment->config().writeEntry("layoutId", "");
         }
 
-        KConfigGroup newGroup = oldContainments.group(QString::number(containment->id()));
-        containment->config().copyTo(&newGroup);
+        QString cId = QString::number(containment->id());
+        KConfigGroup fileGroup = fileContainments.group(cId);
+
+        //! unchanged containments are not rewritten, changed ones are copied as a whole
+        //! in order to preserve the entries flags
+        if (groupsDiffer(containment->config(), fileGroup, QStringList("layoutId"))) {
+            fileGroup.deleteGroup();
+            containment->config().copyTo(&fileGroup);
+            ++updatedGroups;
+        }
+
+        //! original layout files never store the layout id
+        if (!fileGroup.hasKey("layoutId") || !fileGroup.readEntry("layoutId", QString()).isEmpty()) {
+            fileGroup.writeEntry("layoutId", "");
+            ++updatedGroups;
+        }
+
+        syncedIds << cId;
+    }
 
-        if (!removeLayoutId) {
-            newGroup.writeEntry("layoutId", "");
-            newGroup.sync();
+    //! remove containments that do not belong to the layout any more
+    for (const auto &cId : fileContainments.groupList()) {
+        if (!syncedIds.contains(cId)) {
+            fileContainments.deleteGroup(cId);
+            ++updatedGroups;
         }
     }
 
-    oldContainments.sync();
+    //! single sync for all updated groups, nothing is written when nothing changed
+    if (updatedGroups > 0) {
+        fileContainments.sync();
+        invalidateSnapshot(layout->file());
+    }
+}
+
+void Storage::scheduleSyncToLayoutFile(Layout::GenericLayout *layout)
+{
+    if (!layout) {
+        return;
+    }
+
+    bool pending{false};
+
+    for (const auto &pendingLayout : m_pendingSyncLayouts) {
+        if (pendingLayout.data() == layout) {
+            pending = true;
+            break;
+        }
+    }
+
+    if (!pending) {
+        m_pendingSyncLayouts << QPointer<Layout::GenericLayout>(layout);
+    }
+
+    //! the timer is not restarted in order for frequent requests to not postpone the sync forever
+    if (!m_syncTimer.isActive()) {
+        m_syncTimer.start();
+    }
+}
+
+void Storage::syncPendingLayoutFiles(const QString &file)
+{
+    const QList<QPointer<Layout::GenericLayout>> layouts = m_pendingSyncLayouts;
+
+    for (const auto &layout : layouts) {
+        if (layout && (file.isEmpty() || layout->file() == file)) {
+            syncToLayoutFile(layout, false);
+        }
+    }
+
+    if (file.isEmpty()) {
+        m_pendingSyncLayouts.clear();
+        m_syncTimer.stop();
+    }
 }
 
 QList<Plasma::Containment *> Storage::importLayoutFile(const Layout::GenericLayout *layout, QString file)
@@ -674,74 +808,216 @@ ViewDelayedCreationData Storage::copyView(const Layout::GenericLayout *layout, P
     return result;
 }
 
-bool Storage::isBroken(const Layout::GenericLayout *layout, QStringList &errors) const
+QStringList Storage::idsErrors(const QStringList &containmentsIds, const QStringList &appletsIds) const
+{
+    QStringList errors;
+    QStringList ids = containmentsIds + appletsIds;
+
+#if QT_VERSION < QT_VERSION_CHECK(5, 14, 0)
+    QSet<QString> idsSet = QSet<QString>::fromList(ids);
+#else
+    QSet<QString> idsSet(ids.begin(), ids.end());
+#endif
+
+    if (idsSet.count() == ids.count()) {
+        return errors;
+    }
+
+    for (const QString &c : containmentsIds) {
+        if (appletsIds.contains(c)) {
+            QString errorStr = i18n("Same applet and containment id found ::: ") + c;
+            qDebug() << "Error: " << errorStr;
+            errors << errorStr;
+        }
+    }
+
+    for (int i = 0; i < ids.count(); ++i) {
+        for (int j = i + 1; j < ids.count(); ++j) {
+            if (ids[i] == ids[j]) {
+                QString errorStr = i18n("Different applets with same id ::: ") + ids[i];
+                qDebug() << "Error: " << errorStr;
+                errors << errorStr;
+            }
+        }
+    }
+
+    return errors;
+}
+
+LayoutFileSnapshot Storage::snapshot(const QString &file)
+{
+    //! delayed writes of the file must not be missed by its readers
+    syncPendingLayoutFiles(file);
+
+    QFileInfo fileInfo(file);
+    KSharedConfigPtr lFile = KSharedConfig::openConfig(file);
+
+    //! unsynced in-memory changes are never part of a cached snapshot
+    bool cacheable = !lFile->isDirty();
+
+    for (int i=0; i<m_snapshots.count(); ++i) {
+        if (m_snapshots[i].file != file) {
+            continue;
+        }
+
+        if (cacheable && m_snapshots[i].lastModified == fileInfo.lastModified() && m_snapshots[i].size == fileInfo.size()) {
+            if (i > 0) {
+                m_snapshots.move(i, 0);
+            }
+
+            return m_snapshots[0];
+        }
+
+        m_snapshots.removeAt(i);
+        break;
+    }
+
+    LayoutFileSnapshot result;
+    result.file = file;
+    result.lastModified = fileInfo.lastModified();
+    result.size = fileInfo.size();
+
+    QStringList contsIds;
+    QStringList appletsIds;
+
+    KConfigGroup containmentGroups = KConfigGroup(lFile, "Containments");
+
+    for (const auto &cId : containmentGroups.groupList()) {
+        KConfigGroup containmentGroup = containmentGroups.group(cId);
+
+        LayoutFileContainmentData cData;
+        cData.id = cId.toInt();
+        cData.isLatteContainment = isLatteContainment(containmentGroup);
+        cData.onPrimary = containmentGroup.readEntry("onPrimary", true);
+        cData.lastScreen = containmentGroup.readEntry("lastScreen", IDNULL);
+        cData.location = containmentGroup.readEntry("location", (int)Plasma::Types::BottomEdge);
+
+        contsIds << cId;
+
+        KConfigGroup appletGroups = containmentGroup.group("Applets");
+
+        for (const auto &appletId : appletGroups.groupList()) {
+            KConfigGroup appletGroup = appletGroups.group(appletId);
+
+            LayoutFileAppletData aData;
+            aData.id = appletId.toInt();
+            aData.isValid = appletGroupIsValid(appletGroup);
+            aData.pluginId = appletGroup.readEntry("plugin", "");
+            aData.subContainmentId = subContainmentId(appletGroup);
+
+            //! reports count only systray subcontainments of all applet groups, removed applets included
+            const int systrayId = appletGroup.group("Configuration").readEntry("SystrayContainmentId", IDNULL);
+
+            if (cData.isLatteContainment && isValid(systrayId)) {
+                result.subContainments[cData.id].append(systrayId);
+            }
+
+            if (!aData.isValid) {
+                result.hasInvalidApplets = true;
+                cData.applets << aData;
+                continue;
+            }
+
+            appletsIds << appletId;
+
+            cData.applets << aData;
+        }
+
+        if (cData.isLatteContainment && isValid(cData.lastScreen) && !result.screens.contains(cData.lastScreen)) {
+            result.screens << cData.lastScreen;
+        }
+
+        result.containments << cData;
+    }
+
+    result.errors = idsErrors(contsIds, appletsIds);
+
+    //! a file modified within the current second could be written again with the same
+    //! size and modification time, such a racy snapshot is not trusted for later queries
+    if (cacheable && result.lastModified.isValid() && result.lastModified.secsTo(QDateTime::currentDateTime()) > 1) {
+        m_snapshots.prepend(result);
+
+        while (m_snapshots.count() > SNAPSHOTSCACHESIZE) {
+            m_snapshots.removeLast();
+        }
+    }
+
+    return result;
+}
+
+void Storage::invalidateSnapshot(const QString &file)
+{
+    for (int i=0; i<m_snapshots.count(); ++i) {
+        if (m_snapshots[i].file == file) {
+            m_snapshots.removeAt(i);
+            return;
+        }
+    }
+}
+
+bool Storage::isBroken(const Layout::GenericLayout *layout, QStringList &errors)
 {
     if (layout->file().isEmpty() || !QFile(layout->file()).exists()) {
         return false;
     }
 
-    QStringList ids;
     QStringList conts;
     QStringList applets;
-
-    KSharedConfigPtr lFile = KSharedConfig::openConfig(layout->file());
+    QStringList brokenErrors;
 
     if (!layout->corona()) {
-        KConfigGroup containmentsEntries = KConfigGroup(lFile, "Containments");
-        ids << containmentsEntries.groupList();
-        conts << ids;
-
-        for (const auto &cId : containmentsEntries.groupList()) {
-            auto appletsEntries = containmentsEntries.group(cId).group("Applets");
-
-            QStringList validAppletIds;
-            bool updated{false};
-
-            for (const auto &appletId : appletsEntries.groupList()) {
-                KConfigGroup appletGroup = appletsEntries.group(appletId);
-
-                if (Layouts::Storage::appletGroupIsValid(appletGroup)) {
-                    validAppletIds << appletId;
-                } else {
-                    updated = true;
-                    //! heal layout file by removing applet config records that are not used any more
-                    qDebug() << "Layout: " << layout->name() << " removing deprecated applet : " << appletId;
-                    appletsEntries.deleteGroup(appletId);
+        LayoutFileSnapshot fileSnapshot = snapshot(layout->file());
+
+        if (fileSnapshot.hasInvalidApplets) {
+            KSharedConfigPtr lFile = KSharedConfig::openConfig(layout->file());
+            KConfigGroup containmentsEntries = KConfigGroup(lFile, "Containments");
+
+            for (const auto &cData : fileSnapshot.containments) {
+                auto appletsEntries = containmentsEntries.group(QString::number(cData.id)).group("Applets");
+                bool updated{false};
+
+                for (const auto &aData : cData.applets) {
+                    if (!aData.isValid) {
+                        updated = true;
+                        //! heal layout file by removing applet config records that are not used any more
+                        qDebug() << "Layout: " << layout->name() << " removing deprecated applet : " << aData.id;
+                        appletsEntries.deleteGroup(QString::number(aData.id));
+                    }
                 }
-            }
 
-            if (updated) {
-                appletsEntries.sync();
+                if (updated) {
+                    appletsEntries.sync();
+                }
             }
 
-            ids << validAppletIds;
-            applets << validAppletIds;
+            invalidateSnapshot(layout->file());
+            fileSnapshot = snapshot(layout->file());
+        }
+
+        for (const auto &cData : fileSnapshot.containments) {
+            conts << QString::number(cData.id);
+
+            for (const auto &aData : cData.applets) {
+                if (aData.isValid) {
+                    applets << QString::number(aData.id);
+                }
+            }
         }
+
+        brokenErrors = fileSnapshot.errors;
     } else {
         for (const auto containment : *layout->containments()) {
-            ids << QString::number(containment->id());
             conts << QString::number(containment->id());
 
             for (const auto applet : containment->applets()) {
-                ids << QString::number(applet->id());
                 applets << QString::number(applet->id());
             }
         }
-    }
-
-#if QT_VERSION < QT_VERSION_CHECK(5, 14, 0)
-    QSet<QString> idsSet = QSet<QString>::fromList(ids);
-#else
-    QSet<QString> idsSet(ids.begin(), ids.end());
-#endif
-    /* a different way to count duplicates
-    QMap<QString, int> countOfStrings;
 
-    for (int i = 0; i < ids.count(); i++) {
-        countOfStrings[ids[i]]++;
-    }*/
+        brokenErrors = idsErrors(conts, applets);
+    }
 
-    if (idsSet.count() != ids.count()) {
+    if (!brokenErrors.isEmpty()) {
         qDebug() << "   ----   ERROR - BROKEN LAYOUT :: " << layout->name() << " ----";
 
         if (!layout->corona()) {
@@ -757,33 +1033,19 @@ bool Storage::isBroken(const Layout::GenericLayout *layout, QStringList &errors)
         qDebug() << "Containments :: " << conts;
         qDebug() << "Applets :: " << applets;
 
-        for (const QString &c : conts) {
-            if (applets.contains(c)) {
-                QString errorStr = i18n("Same applet and containment id found ::: ") + c;
-                qDebug() << "Error: " << errorStr;
-                errors << errorStr;
-            }
-        }
-
-        for (int i = 0; i < ids.count(); ++i) {
-            for (int j = i + 1; j < ids.count(); ++j) {
-                if (ids[i] == ids[j]) {
-                    QString errorStr = i18n("Different applets with same id ::: ") + ids[i];
-                    qDebug() << "Error: " << errorStr;
-                    errors << errorStr;
-                }
-            }
-        }
+        errors << brokenErrors;
 
         qDebug() << "  -- - -- - -- - -- - - -- - - - - -- - - - - ";
 
         if (!layout->corona()) {
-            KConfigGroup containmentsEntries = KConfigGroup(lFile, "Containments");
+            for (const auto &cData : snapshot(layout->file()).containments) {
+                QStringList appletsIds;
 
-            for (const auto &cId : containmentsEntries.groupList()) {
-                auto appletsEntries = containmentsEntries.group(cId).group("Applets");
+                for (const auto &aData : cData.applets) {
+                    appletsIds << QString::number(aData.id);
+                }
 
-                qDebug() << " CONTAINMENT : " << cId << " APPLETS : " << appletsEntries.groupList();
+                qDebug() << " CONTAINMENT : " << cData.id << " APPLETS : " << appletsIds;
             }
         } else {
             for (const auto containment : *layout->containments()) {
@@ -889,8 +1151,7 @@ Data::AppletsTable Storage::plugins(const QString &layoutfile, const int contain
         return knownapplets;
     }
 
-    KSharedConfigPtr lFile = KSharedConfig::openConfig(layoutfile);
-    KConfigGroup containmentGroups = KConfigGroup(lFile, "Containments");
+    LayoutFileSnapshot fileSnapshot = snapshot(layoutfile);
 
     //! empty means all containments are valid
     QList<int> validcontainmentids;
@@ -899,36 +1160,30 @@ Data::AppletsTable Storage::plugins(const QString &layoutfile, const int contain
         validcontainmentids << containmentid;
 
         //! searching for specific containment and subcontainments and ignore all other containments
-        for (const auto &cId : containmentGroups.groupList()) {
-            if (cId.toInt() != containmentid) {
+        for (const auto &cData : fileSnapshot.containments) {
+            if (cData.id != containmentid) {
                 //! ignore irrelevant containments
                 continue;
             }
 
-            auto appletGroups = containmentGroups.group(cId).group("Applets");
-
-            for (const auto &appletId : appletGroups.groupList()) {
-                KConfigGroup appletCfg = appletGroups.group(appletId);
-                if (isSubContainment(appletCfg)) {
-                    validcontainmentids << subContainmentId(appletCfg);
+            for (const auto &aData : cData.applets) {
+                if (isValid(aData.subContainmentId)) {
+                    validcontainmentids << aData.subContainmentId;
                 }
             }
         }
     }
 
     //! cycle through valid contaiments in order to retrieve their metadata
-    for (const auto &cId : containmentGroups.groupList()) {
-        if (validcontainmentids.count()>0 && !validcontainmentids.contains(cId.toInt())) {
+    for (const auto &cData : fileSnapshot.containments) {
+        if (validcontainmentids.count()>0 && !validcontainmentids.contains(cData.id)) {
             //! searching only for valid containments
             continue;
         }
 
-        auto appletGroups = containmentGroups.group(cId).group("Applets");
-
-        for (const auto &appletId : appletGroups.groupList()) {
-            KConfigGroup appletCfg = appletGroups.group(appletId);
-            if (!isSubContainment(appletCfg)) {
-                QString pluginId = appletCfg.readEntry("plugin", "");
+        for (const auto &aData : cData.applets) {
+            if (!isValid(aData.subContainmentId)) {
+                QString pluginId = aData.pluginId;
 
                 if (!knownapplets.containsId(pluginId) && !unknownapplets.containsId(pluginId)) {
                     Data::Applet appletdata = metadata(pluginId);
@@ -956,30 +1211,19 @@ void Storage::subContainmentsInfo(const QString &file, QHash<int, QList<int>> &s
     assignedSubContainments.clear();
     orphanSubContainments.clear();
 
-    KSharedConfigPtr lFile = KSharedConfig::openConfig(file);
-    KConfigGroup containmentGroups = KConfigGroup(lFile, "Containments");
+    LayoutFileSnapshot fileSnapshot = snapshot(file);
 
     //! assigned subcontainments
-    for (const auto &cId : containmentGroups.groupList()) {
-        if (Layouts::Storage::self()->isLatteContainment(containmentGroups.group(cId))) {
-            auto applets = containmentGroups.group(cId).group("Applets");
-
-            for (const auto &applet : applets.groupList()) {
-                KConfigGroup appletSettings = applets.group(applet).group("Configuration");
-                int tSubId = appletSettings.readEntry("SystrayContainmentId", IDNULL);
+    subContainments = fileSnapshot.subContainments;
 
-                if (isValid(tSubId)) {
-                    assignedSubContainments << tSubId;
-                    subContainments[cId.toInt()].append(tSubId);
-                }
-            }
-        }
+    for (const auto &subs : fileSnapshot.subContainments) {
+        assignedSubContainments << subs;
     }
 
     //! orphan subcontainments
-    for (const auto &cId : containmentGroups.groupList()) {
-        if (!Layouts::Storage::self()->isLatteContainment(containmentGroups.group(cId)) && !assignedSubContainments.contains(cId.toInt())) {
-            orphanSubContainments << cId.toInt();
+    for (const auto &cData : fileSnapshot.containments) {
+        if (!cData.isLatteContainment && !assignedSubContainments.contains(cData.id)) {
+            orphanSubContainments << cData.id;
         }
     }
 }
@@ -988,31 +1232,27 @@ QList<Layout::ViewData> Storage::viewsData(const QString &file, const QHash<int,
 {
     QList<Layout::ViewData> viewsData;
 
-    KSharedConfigPtr lFile = KSharedConfig::openConfig(file);
-    KConfigGroup containmentGroups = KConfigGroup(lFile, "Containments");
-
-    for (const auto &cId : containmentGroups.groupList()) {
-        if (Layouts::Storage::self()->isLatteContainment(containmentGroups.group(cId))) {
+    for (const auto &cData : snapshot(file).containments) {
+        if (cData.isLatteContainment) {
             Layout::ViewData vData;
-            int id = cId.toInt();
 
             //! id
-            vData.id = id;
+            vData.id = cData.id;
 
             //! active
             vData.active = false;
 
             //! onPrimary
-            vData.onPrimary = containmentGroups.group(cId).readEntry("onPrimary", true);
+            vData.onPrimary = cData.onPrimary;
 
             //! Screen
-            vData.screenId = containmentGroups.group(cId).readEntry("lastScreen", IDNULL);
+            vData.screenId = cData.lastScreen;
 
             //! location
-            vData.location = containmentGroups.group(cId).readEntry("location", (int)Plasma::Types::BottomEdge);
+            vData.location = cData.location;
 
             //! subcontainments
-            vData.subContainments = subContainments[id];
+            vData.subContainments = subContainments[cData.id];
 
             viewsData << vData;
         }
@@ -1023,23 +1263,7 @@ QList<Layout::ViewData> Storage::viewsData(const QString &file, const QHash<int,
 
 QList<int> Storage::viewsScreens(const QString &file)
 {
-    QList<int> screens;
-
-    KSharedConfigPtr lFile = KSharedConfig::openConfig(file);
-
-    KConfigGroup containmentGroups = KConfigGroup(lFile, "Containments");
-
-    for (const auto &cId : containmentGroups.groupList()) {
-        if (Layouts::Storage::self()->isLatteContainment(containmentGroups.group(cId))) {
-            int screenId = containmentGroups.group(cId).readEntry("lastScreen", IDNULL);
-
-            if (isValid(screenId) && !screens.contains(screenId)) {
-                screens << screenId;
-            }
-        }
-    }
-
-    return screens;
+    return snapshot(file).screens;
 }
 
 }
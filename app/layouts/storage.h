@@ -24,7 +24,11 @@
 #include "../data/appletdata.h"
 
 // Qt
+#include <QDateTime>
+#include <QHash>
+#include <QPointer>
 #include <QTemporaryDir>
+#include <QTimer>
 
 // KDE
 #include <KConfigGroup>
@@ -49,6 +53,43 @@ struct SubContaimentIdentityData
     QString cfgProperty;
 };
 
+struct LayoutFileAppletData
+{
+    int id{-1};
+    QString pluginId;
+    int subContainmentId{-1};
+    //! false when the applet config group belongs to a removed applet
+    bool isValid{true};
+};
+
+struct LayoutFileContainmentData
+{
+    int id{-1};
+    bool isLatteContainment{false};
+    bool onPrimary{true};
+    int lastScreen{-1};
+    int location{Plasma::Types::BottomEdge};
+    QList<LayoutFileAppletData> applets;
+};
+
+//! Information of a layout file gathered through a single pass
+//! of its Containments/Applets groups
+struct LayoutFileSnapshot
+{
+    QString file;
+    QDateTime lastModified;
+    qint64 size{0};
+    bool hasInvalidApplets{false};
+
+    QList<LayoutFileContainmentData> containments;
+    //! [containment id, list<systray subcontainment ids>], it is used for reports
+    QHash<int, QList<int>> subContainments;
+    //! list<screens ids>
+    QList<int> screens;
+    //! broken layout errors
+    QStringList errors;
+};
+
 struct ViewDelayedCreationData
 {
     Plasma::Containment *containment{nullptr};
@@ -70,7 +111,7 @@ public:
     bool isWritable(const Layout::GenericLayout *layout) const;
     bool isLatteContainment(Plasma::Containment *containment) const;
     bool isLatteContainment(const KConfigGroup &group) const;
-    bool isBroken(const Layout::GenericLayout *layout, QStringList &errors) const;
+    bool isBroken(const Layout::GenericLayout *layout, QStringList &errors);
     bool isSubContainment(const Layout::GenericLayout *layout, const Plasma::Applet *applet) const;
 
     int subContainmentId(const KConfigGroup &appletGroup) const;
@@ -82,6 +123,10 @@ public:
 
     void importToCorona(const Layout::GenericLayout *layout);
     void syncToLayoutFile(const Layout::GenericLayout *layout, bool removeLayoutId);
+    //! coalesces frequent layout file syncs into a single delayed one
+    void scheduleSyncToLayoutFile(Layout::GenericLayout *layout);
+    //! writes immediately the delayed syncs of layouts using the provided file, all of them when file is empty
+    void syncPendingLayoutFiles(const QString &file = QString());
     ViewDelayedCreationData copyView(const Layout::GenericLayout *layout, Plasma::Containment *containment);
 
 
@@ -110,6 +155,16 @@ private:
     bool isSubContainment(const KConfigGroup &appletGroup) const;
     int subIdentityIndex(const KConfigGroup &appletGroup) const;
 
+    QStringList idsErrors(const QStringList &containmentsIds, const QStringList &appletsIds) const;
+
+    //! true when entries or subgroups of source and target are not the same
+    bool groupsDiffer(const KConfigGroup &source, const KConfigGroup &target, const QStringList &ignoredKeys = QStringList()) const;
+
+    //! layout file snapshots are memoized based on file path, modification time and size,
+    //! every write of Storage to a layout file invalidates its snapshot explicitly
+    LayoutFileSnapshot snapshot(const QString &file);
+    void invalidateSnapshot(const QString &file);
+
     //! STORAGE !////
     QString availableId(QStringList all, QStringList assigned, int base);
     //! provides a new file path based the provided file. The new file
@@ -123,6 +178,14 @@ private:
     QTemporaryDir m_storageTmpDir;
 
     QList<SubContaimentIdentityData> m_subIdentities;
+
+    static const int SNAPSHOTSCACHESIZE = 16;
+
+    //! most recently used snapshots first
+    QList<LayoutFileSnapshot> m_snapshots;
+
+    QTimer m_syncTimer;
+    QList<QPointer<Layout::GenericLayout>> m_pendingSyncLayouts;
 };
 
 }
@@ -27,6 +27,7 @@
 #include "../layouts/synchronizer.h"
 
 // Qt
+#include <QMetaProperty>
 #include <QQuickItem>
 
 // Plasma
@@ -41,6 +42,9 @@ SyncedLaunchers::SyncedLaunchers(QObject *parent)
     : QObject(parent)
 {
     m_manager = qobject_cast<Layouts::Manager *>(parent);
+
+    int slotIndex = metaObject()->indexOfSlot("onClientPropertiesChanged()");
+    m_clientPropertiesChangedSlot = metaObject()->method(slotIndex);
 }
 
 SyncedLaunchers::~SyncedLaunchers()
@@ -49,13 +53,29 @@ SyncedLaunchers::~SyncedLaunchers()
 
 void SyncedLaunchers::addAbilityClient(QQuickItem *client)
 {
-    if (m_clients.contains(client)) {
+    if (!client || m_clients.contains(client)) {
         return;
     }
 
     m_clients << client;
 
+    updateClientData(client);
+    indexClient(client);
+
     connect(client, &QObject::destroyed, this, &SyncedLaunchers::removeClientObject);
+
+    //! track client properties that are used for its registry position
+    for (const auto &propertyName : {"layoutName", "launchersGroup"}) {
+        int propertyIndex = client->metaObject()->indexOfProperty(propertyName);
+
+        if (propertyIndex >= 0) {
+            QMetaProperty property = client->metaObject()->property(propertyIndex);
+
+            if (property.hasNotifySignal()) {
+                connect(client, property.notifySignal(), this, m_clientPropertiesChangedSlot);
+            }
+        }
+    }
 }
 
 void SyncedLaunchers::removeAbilityClient(QQuickItem *client)
@@ -64,35 +84,108 @@ void SyncedLaunchers::removeAbilityClient(QQuickItem *client)
         return;
     }
 
-    disconnect(client, &QObject::destroyed, this, &SyncedLaunchers::removeClientObject);
+    disconnect(client, nullptr, this, nullptr);
+
+    unindexClient(client);
+    m_clientsData.remove(client);
     m_clients.removeAll(client);
 }
 
 void SyncedLaunchers::removeClientObject(QObject *obj)
 {
-    QQuickItem *item = qobject_cast<QQuickItem *>(obj);
+    //! the object is already destroyed at this point, so it can not be casted safely
+    QQuickItem *item = static_cast<QQuickItem *>(obj);
 
-    if (item) {
-        removeAbilityClient(item);
+    if (m_clients.contains(item)) {
+        unindexClient(item);
+        m_clientsData.remove(item);
+        m_clients.removeAll(item);
     }
 }
 
-QList<QQuickItem *> SyncedLaunchers::clients(QString layoutName)
+void SyncedLaunchers::onClientPropertiesChanged()
 {
-    QList<QQuickItem *> items;
+    QQuickItem *client = qobject_cast<QQuickItem *>(sender());
 
-    if (!layoutName.isEmpty()) {
-        for(const auto client: m_clients) {
-            QString cLayoutName = client->property("layoutName").toString();
-            if (cLayoutName == layoutName) {
-                items << client;
-            }
+    if (!client || !m_clients.contains(client)) {
+        return;
+    }
+
+    unindexClient(client);
+    updateClientData(client);
+    indexClient(client);
+}
+
+void SyncedLaunchers::updateClientData(QQuickItem *client)
+{
+    const QMetaObject *metaObject = client->metaObject();
+
+    auto clientMethod = [&metaObject](const char *signature) {
+        int methodIndex = metaObject->indexOfMethod(signature);
+
+        if (methodIndex == -1) {
+            qDebug() << "Launchers Syncer Ability: " << signature << " was NOT found...";
+            return QMetaMethod();
+        }
+
+        return metaObject->method(methodIndex);
+    };
+
+    SyncedLaunchersClientData data = m_clientsData.value(client);
+
+    data.clientId = client->property("clientId").toUInt();
+    data.launchersGroup = client->property("launchersGroup").toInt();
+    data.layoutName = client->property("layoutName").toString();
+
+    //! methods are resolved only once for each client
+    if (!m_clientsData.contains(client)) {
+        data.addSyncedLauncher = clientMethod("addSyncedLauncher(QVariant,QVariant)");
+        data.removeSyncedLauncher = clientMethod("removeSyncedLauncher(QVariant,QVariant)");
+        data.addSyncedLauncherToActivity = clientMethod("addSyncedLauncherToActivity(QVariant,QVariant,QVariant)");
+        data.removeSyncedLauncherFromActivity = clientMethod("removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)");
+        data.dropSyncedUrls = clientMethod("dropSyncedUrls(QVariant,QVariant)");
+        data.validateSyncedLaunchersOrder = clientMethod("validateSyncedLaunchersOrder(QVariant,QVariant)");
+    }
+
+    m_clientsData[client] = data;
+}
+
+void SyncedLaunchers::indexClient(QQuickItem *client)
+{
+    if (!m_clientsData.contains(client)) {
+        return;
+    }
+
+    const SyncedLaunchersClientData &data = m_clientsData[client];
+    QString lName = (data.launchersGroup == Types::LayoutLaunchers) ? data.layoutName : "";
+
+    if (!m_registry[data.launchersGroup][lName].contains(client)) {
+        m_registry[data.launchersGroup][lName] << client;
+    }
+}
+
+void SyncedLaunchers::unindexClient(QQuickItem *client)
+{
+    if (!m_clientsData.contains(client)) {
+        return;
+    }
+
+    const SyncedLaunchersClientData &data = m_clientsData[client];
+    QString lName = (data.launchersGroup == Types::LayoutLaunchers) ? data.layoutName : "";
+
+    if (m_registry.contains(data.launchersGroup)) {
+        QHash<QString, QList<QQuickItem *>> &groupClients = m_registry[data.launchersGroup];
+        groupClients[lName].removeAll(client);
+
+        if (groupClients[lName].isEmpty()) {
+            groupClients.remove(lName);
         }
-    } else {
-        items = m_clients;
     }
+}
 
-    return items;
+QList<QQuickItem *> SyncedLaunchers::clients(int launcherGroup, QString layoutName) const
+{
+    return m_registry.value(launcherGroup).value(layoutName);
 }
 
 void SyncedLaunchers::addLauncher(QString layoutName, int launcherGroup, QString launcher)
@@ -105,16 +198,10 @@ void SyncedLaunchers::addLauncher(QString layoutName, int launcherGroup, QString
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto client : clients(lName)) {
-        if (auto *metaObject = client->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncher(QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+    for(const auto client : clients(launcherGroup, lName)) {
+        QMetaMethod method = m_clientsData.value(client).addSyncedLauncher;
 
-            QMetaMethod method = metaObject->method(methodIndex);
+        if (method.isValid()) {
             method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
         }
     }
@@ -130,16 +217,10 @@ void SyncedLaunchers::removeLauncher(QString layoutName, int launcherGroup, QStr
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto client : clients(lName)) {
-        if (auto *metaObject = client->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncher(QVariant,QVariant)");
+    for(const auto client : clients(launcherGroup, lName)) {
+        QMetaMethod method = m_clientsData.value(client).removeSyncedLauncher;
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncher(QVariant,QVariant) was NOT found...";
-                continue;
-            }
-
-            QMetaMethod method = metaObject->method(methodIndex);
+        if (method.isValid()) {
             method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher));
         }
     }
@@ -155,16 +236,10 @@ void SyncedLaunchers::addLauncherToActivity(QString layoutName, int launcherGrou
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto client : clients(lName)) {
-        if (auto *metaObject = client->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("addSyncedLauncherToActivity(QVariant,QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: addSyncedLauncherToActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
+    for(const auto client : clients(launcherGroup, lName)) {
+        QMetaMethod method = m_clientsData.value(client).addSyncedLauncherToActivity;
 
-            QMetaMethod method = metaObject->method(methodIndex);
+        if (method.isValid()) {
             method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
         }
     }
@@ -180,16 +255,10 @@ void SyncedLaunchers::removeLauncherFromActivity(QString layoutName, int launche
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto client : clients(lName)) {
-        if (auto *metaObject = client->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant)");
+    for(const auto client : clients(launcherGroup, lName)) {
+        QMetaMethod method = m_clientsData.value(client).removeSyncedLauncherFromActivity;
 
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: removeSyncedLauncherFromActivity(QVariant,QVariant,QVariant) was NOT found...";
-                continue;
-            }
-
-            QMetaMethod method = metaObject->method(methodIndex);
+        if (method.isValid()) {
             method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launcher), Q_ARG(QVariant, activity));
         }
     }
@@ -205,16 +274,10 @@ void SyncedLaunchers::urlsDropped(QString layoutName, int launcherGroup, QString
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto client : clients(lName)) {
-        if (auto *metaObject = client->metaObject()) {
-            int methodIndex = metaObject->indexOfMethod("dropSyncedUrls(QVariant,QVariant)");
-
-            if (methodIndex == -1) {
-                qDebug() << "Launchers Syncer Ability: dropSyncedUrls(QVariant,QVariant) was NOT found...";
-                continue;
-            }
+    for(const auto client : clients(launcherGroup, lName)) {
+        QMetaMethod method = m_clientsData.value(client).dropSyncedUrls;
 
-            QMetaMethod method = metaObject->method(methodIndex);
+        if (method.isValid()) {
             method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, urls));
         }
     }
@@ -230,21 +293,11 @@ void SyncedLaunchers::validateLaunchersOrder(QString layoutName, uint senderId,
 
     QString lName = (group == Types::LayoutLaunchers) ? layoutName : "";
 
-    for(const auto client : clients(lName)) {
-        uint clientId = client->property("clientId").toUInt();
+    for(const auto client : clients(launcherGroup, lName)) {
+        SyncedLaunchersClientData data = m_clientsData.value(client);
 
-        if (clientId != senderId) {
-            if (auto *metaObject = client->metaObject()) {
-                int methodIndex = metaObject->indexOfMethod("validateSyncedLaunchersOrder(QVariant,QVariant)");
-
-                if (methodIndex == -1) {
-                    qDebug() << "Launchers Syncer Ability: validateSyncedLaunchersOrder(QVariant,QVariant) was NOT found...";
-                    continue;
-                }
-
-                QMetaMethod method = metaObject->method(methodIndex);
-                method.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launchers));
-            }
+        if (data.clientId != senderId && data.validateSyncedLaunchersOrder.isValid()) {
+            data.validateSyncedLaunchersOrder.invoke(client, Q_ARG(QVariant, launcherGroup), Q_ARG(QVariant, launchers));
         }
     }
 }
@@ -21,7 +21,9 @@
 #define SYNCEDLAUNCHERS_H
 
 // Qt
+#include <QHash>
 #include <QList>
+#include <QMetaMethod>
 #include <QObject>
 #include <QQuickItem>
 
@@ -38,6 +40,24 @@ class Manager;
 namespace Latte {
 namespace Layouts {
 
+//! client information and its resolved synced launchers methods.
+//! Clients are the qml launchers abilities of tasks plasmoids and containments and their
+//! synced launchers functions are plain qml functions, so they can be reached only through
+//! the meta object with QVariant arguments; no typed C++ interface can be implemented by them
+struct SyncedLaunchersClientData
+{
+    uint clientId{0};
+    int launchersGroup{-1};
+    QString layoutName;
+
+    QMetaMethod addSyncedLauncher;
+    QMetaMethod removeSyncedLauncher;
+    QMetaMethod addSyncedLauncherToActivity;
+    QMetaMethod removeSyncedLauncherFromActivity;
+    QMetaMethod dropSyncedUrls;
+    QMetaMethod validateSyncedLaunchersOrder;
+};
+
 //! in order to support property the launcher groups Layout and Global
 //! the latte plasmoids must communicate between them with signals when
 //! there are changes in their models. This way we are trying to avoid
@@ -64,15 +84,27 @@ public slots:
     Q_INVOKABLE void validateLaunchersOrder(QString layoutName, uint senderId, int launcherGroup, QStringList launchers);
 
 private:
-    QList<QQuickItem *> clients(QString layoutName = QString());
+    QList<QQuickItem *> clients(int launcherGroup, QString layoutName = QString()) const;
+
+    void indexClient(QQuickItem *client);
+    void unindexClient(QQuickItem *client);
+    void updateClientData(QQuickItem *client);
 
 private slots:
     void removeClientObject(QObject *obj);
+    void onClientPropertiesChanged();
 
 private:
     Layouts::Manager *m_manager{nullptr};
 
+    QMetaMethod m_clientPropertiesChangedSlot;
+
     QList<QQuickItem *> m_clients;
+    QHash<QQuickItem *, SyncedLaunchersClientData> m_clientsData;
+
+    //! launchers group -> layout name -> clients,
+    //! layout name is empty for groups that are not layout based
+    QHash<int, QHash<QString, QList<QQuickItem *>>> m_registry;
 };
 
 }
@@ -657,6 +657,36 @@ void PanelBackground::updateRoundness(Plasma::Svg *svg)
     }
 }
 
+void PanelBackground::loadCache(const KConfigGroup &group)
+{
+    m_paddingTop = group.readEntry("paddingTop", 0);
+    m_paddingLeft = group.readEntry("paddingLeft", 0);
+    m_paddingBottom = group.readEntry("paddingBottom", 0);
+    m_paddingRight = group.readEntry("paddingRight", 0);
+    m_shadowSize = group.readEntry("shadowSize", 0);
+    m_roundness = group.readEntry("roundness", 0);
+    m_maxOpacity = (float)group.readEntry("maxOpacity", 1.0);
+    m_shadowColor = group.readEntry("shadowColor", QColor(Qt::black));
+
+    emit paddingsChanged();
+    emit roundnessChanged();
+    emit shadowColorChanged();
+    emit shadowSizeChanged();
+    emit maxOpacityChanged();
+}
+
+void PanelBackground::saveCache(KConfigGroup group) const
+{
+    group.writeEntry("paddingTop", m_paddingTop);
+    group.writeEntry("paddingLeft", m_paddingLeft);
+    group.writeEntry("paddingBottom", m_paddingBottom);
+    group.writeEntry("paddingRight", m_paddingRight);
+    group.writeEntry("shadowSize", m_shadowSize);
+    group.writeEntry("roundness", m_roundness);
+    group.writeEntry("maxOpacity", (double)m_maxOpacity);
+    group.writeEntry("shadowColor", m_shadowColor);
+}
+
 void PanelBackground::update()
 {
     Plasma::Svg *backSvg = new Plasma::Svg(this);
@@ -24,6 +24,9 @@
 // Qt
 #include <QObject>
 
+// KDE
+#include <KConfigGroup>
+
 // Plasma
 #include <Plasma>
 #include <Plasma/FrameSvg>
@@ -68,6 +71,10 @@ public:
 
     QColor shadowColor() const;
 
+    //! analysis results are cached per plasma theme, see Theme::updateBackgrounds()
+    void loadCache(const KConfigGroup &group);
+    void saveCache(KConfigGroup group) const;
+
 public slots:
     void update();
 
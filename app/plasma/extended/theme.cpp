@@ -30,9 +30,13 @@
 
 // Qt
 #include <QDebug>
+#include <QDateTime>
 #include <QDir>
+#include <QFileInfo>
 #include <QPainter>
 #include <QProcess>
+#include <QStandardPaths>
+#include <QVector>
 
 // KDE
 #include <KDirWatch>
@@ -48,9 +52,72 @@
 namespace Latte {
 namespace PlasmaExtended {
 
+namespace {
+//! transparent width of row y of a top-left rounded corner. The corner follows a circle
+//! of diameter 2*radius+2 and a pixel is transparent when its center is outside of it.
+//! Pixel centers are used for both axes, so that rows and columns are symmetric, and
+//! everything is computed in half pixels in order to stay in integers
+constexpr int cornerSpan(int radius, int y)
+{
+    const int diameter = 2 * radius + 2;
+    const int dy = 2 * y + 1 - diameter;
+
+    int span = 0;
+
+    while (span < radius
+           && (2 * span + 1 - diameter) * (2 * span + 1 - diameter) + dy * dy > diameter * diameter) {
+        ++span;
+    }
+
+    return span;
+}
+
+const int MAXPRECOMPUTEDCORNERRADIUS = 32;
+
+struct CornerSpansTable {
+    int spans[MAXPRECOMPUTEDCORNERRADIUS + 1][MAXPRECOMPUTEDCORNERRADIUS];
+};
+
+constexpr CornerSpansTable cornerSpansTable()
+{
+    CornerSpansTable table{};
+
+    for (int radius = 1; radius <= MAXPRECOMPUTEDCORNERRADIUS; ++radius) {
+        for (int y = 0; y < radius; ++y) {
+            table.spans[radius][y] = cornerSpan(radius, y);
+        }
+    }
+
+    return table;
+}
+
+//! common radii are resolved at compile time
+constexpr CornerSpansTable s_cornerSpans = cornerSpansTable();
+
+//! a corner must look the same when it is mirrored over its diagonal,
+//! so the transparent pixels of column x must be the ones of row x
+constexpr bool cornerSpansAreSymmetric(const CornerSpansTable &table)
+{
+    for (int radius = 1; radius <= MAXPRECOMPUTEDCORNERRADIUS; ++radius) {
+        for (int y = 0; y < radius; ++y) {
+            for (int x = 0; x < radius; ++x) {
+                if ((x < table.spans[radius][y]) != (y < table.spans[radius][x])) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static_assert(cornerSpansAreSymmetric(s_cornerSpans), "corner spans must be symmetric");
+}
+
 Theme::Theme(KSharedConfig::Ptr config, QObject *parent) :
     QObject(parent),
     m_themeGroup(KConfigGroup(config, QStringLiteral("PlasmaThemeExtended"))),
+    m_backgroundsCache(KSharedConfig::openConfig(QStringLiteral("lattedockthemecacherc"), KConfig::SimpleConfig, QStandardPaths::GenericCacheLocation)),
     m_backgroundTopEdge(new PanelBackground(Plasma::Types::TopEdge, this)),
     m_backgroundLeftEdge(new PanelBackground(Plasma::Types::LeftEdge, this)),
     m_backgroundBottomEdge(new PanelBackground(Plasma::Types::BottomEdge, this)),
@@ -308,14 +375,71 @@ void Theme::updateReversedSchemeValues()
     }
 }
 
+QString Theme::backgroundsCacheId() const
+{
+    //! theme version and panel background modification time identify theme updates,
+    //! compositing chooses between the translucent and opaque theme variants
+    KConfigGroup metadata(KSharedConfig::openConfig(m_themePath + "/metadata.desktop", KConfig::SimpleConfig), "Desktop Entry");
+    QString version = metadata.readEntry("X-KDE-PluginInfo-Version", QString());
+
+    QFileInfo backgroundFile(m_themeWidgetsPath + "/panel-background.svgz");
+
+    if (!backgroundFile.exists()) {
+        backgroundFile = QFileInfo(m_themeWidgetsPath + "/panel-background.svg");
+    }
+
+    return QStringList({m_theme.themeName(),
+                        version,
+                        QString::number(backgroundFile.lastModified().toMSecsSinceEpoch()),
+                        m_theme.color(Plasma::Theme::BackgroundColor).name(),
+                        m_compositing ? QStringLiteral("translucent") : QStringLiteral("opaque")}).join("_");
+}
+
 void Theme::updateBackgrounds()
 {
+    KConfigGroup cache(m_backgroundsCache, backgroundsCacheId());
+
+    if (cache.exists()) {
+        m_hasShadow = cache.readEntry("hasShadow", false);
+        emit hasShadowChanged();
+
+        m_backgroundTopEdge->loadCache(KConfigGroup(&cache, "TopEdge"));
+        m_backgroundLeftEdge->loadCache(KConfigGroup(&cache, "LeftEdge"));
+        m_backgroundBottomEdge->loadCache(KConfigGroup(&cache, "BottomEdge"));
+        m_backgroundRightEdge->loadCache(KConfigGroup(&cache, "RightEdge"));
+
+        qDebug() << "PLASMA THEME, panel backgrounds loaded from cache ::: " << cache.name();
+        return;
+    }
+
     updateHasShadow();
 
     m_backgroundTopEdge->update();
     m_backgroundLeftEdge->update();
     m_backgroundBottomEdge->update();
     m_backgroundRightEdge->update();
+
+    //! older entries of the same theme variant are outdated, theme names can contain
+    //! the group name delimiter so they are matched through their exact entries
+    QString themeName = m_theme.themeName();
+    QString variant = m_compositing ? QStringLiteral("translucent") : QStringLiteral("opaque");
+
+    for (const auto &group : m_backgroundsCache->groupList()) {
+        KConfigGroup cachedGroup(m_backgroundsCache, group);
+
+        if (cachedGroup.readEntry("theme", QString()) == themeName && cachedGroup.readEntry("variant", QString()) == variant) {
+            m_backgroundsCache->deleteGroup(group);
+        }
+    }
+
+    cache.writeEntry("theme", themeName);
+    cache.writeEntry("variant", variant);
+    cache.writeEntry("hasShadow", m_hasShadow);
+    m_backgroundTopEdge->saveCache(KConfigGroup(&cache, "TopEdge"));
+    m_backgroundLeftEdge->saveCache(KConfigGroup(&cache, "LeftEdge"));
+    m_backgroundBottomEdge->saveCache(KConfigGroup(&cache, "BottomEdge"));
+    m_backgroundRightEdge->saveCache(KConfigGroup(&cache, "RightEdge"));
+    m_backgroundsCache->sync();
 }
 
 void Theme::updateHasShadow()
@@ -421,60 +545,54 @@ const CornerRegions &Theme::cornersMask(const int &radius)
         return m_cornerRegions[radius];
     }
 
-    qDebug() << radius;
     CornerRegions corners;
 
-    int axis = (2 * radius) + 2;
-    QImage cornerimage(axis, axis, QImage::Format_ARGB32);
-    QPainter painter(&cornerimage);
-    //!does not provide valid masks
-    //painter.setRenderHints(QPainter::Antialiasing);
+    //! rows of the top-left corner, consecutive rows with the same span are merged
+    QVector<QRect> rows;
 
-    QPen pen(Qt::black);
-    pen.setStyle(Qt::SolidLine);
-    pen.setWidth(1);
-    painter.setPen(pen);
-
-    QRect rectArea(0,0,axis,axis);
-    painter.fillRect(rectArea, Qt::white);
-    painter.drawRoundedRect(rectArea, axis, axis);
-
-    QRegion topleft;
     for(int y=0; y<radius; ++y) {
-        QRgb *line = (QRgb *)cornerimage.scanLine(y);
-
-        QString bits;
-        int width{0};
-        for(int x=0; x<radius; ++x) {
-            QRgb point = line[x];
-
-            if (QColor(point) == Qt::black) {
-                bits = bits + "1 ";
-                width = qMax(0, x);
-                break;
-            } else {
-                bits = bits + "0 ";
-            }
+        int span = (radius <= MAXPRECOMPUTEDCORNERRADIUS ? s_cornerSpans.spans[radius][y] : cornerSpan(radius, y));
+
+        if (span <= 0) {
+            //! spans only shrink moving away from the top edge
+            break;
         }
 
-        if (width>0) {
-            topleft += QRect(0, y, width, 1);
+        if (!rows.isEmpty() && rows.last().width() == span) {
+            rows.last().setHeight(rows.last().height() + 1);
+        } else {
+            rows << QRect(0, y, span, 1);
         }
+    }
 
-        qDebug()<< "  " << bits;
+    if (rows.isEmpty()) {
+        m_cornerRegions[radius] = corners;
+        return m_cornerRegions[radius];
     }
-    corners.topLeft = topleft;
 
-    QTransform transform;
-    transform.rotate(90);
-    corners.topRight = transform.map(corners.topLeft);
-    corners.topRight.translate(corners.topLeft.boundingRect().width(), 0);
+    //! the other corners are the mirrored top-left corner inside its bounding box
+    const int width = rows.first().width();
+    const int height = rows.last().bottom() + 1;
+
+    QVector<QRect> topRightRows;
+    QVector<QRect> bottomLeftRows;
+    QVector<QRect> bottomRightRows;
 
-    corners.bottomRight = transform.map(corners.topRight);
-    corners.bottomRight.translate(corners.topLeft.boundingRect().width(), 0);
+    for (const auto &row : rows) {
+        topRightRows << QRect(width - row.width(), row.y(), row.width(), row.height());
+    }
+
+    for (int i=rows.count()-1; i>=0; --i) {
+        const QRect &row = rows[i];
+        int mirroredY = height - row.bottom() - 1;
+        bottomLeftRows << QRect(0, mirroredY, row.width(), row.height());
+        bottomRightRows << QRect(width - row.width(), mirroredY, row.width(), row.height());
+    }
 
-    corners.bottomLeft = transform.map(corners.bottomRight);
-    corners.bottomLeft.translate(corners.topLeft.boundingRect().width(), 0);
+    corners.topLeft.setRects(rows.constData(), rows.count());
+    corners.topRight.setRects(topRightRows.constData(), topRightRows.count());
+    corners.bottomLeft.setRects(bottomLeftRows.constData(), bottomLeftRows.count());
+    corners.bottomRight.setRects(bottomRightRows.constData(), bottomRightRows.count());
 
     //qDebug() << " reg top;: " << corners.topLeft;
     //qDebug() << " reg topr: " << corners.topRight;
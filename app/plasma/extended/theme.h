@@ -119,6 +119,8 @@ private:
     void loadCompositingRoundness();
     void updateBackgrounds();
 
+    QString backgroundsCacheId() const;
+
     void setOriginalSchemeFile(const QString &file);
     void updateHasShadow();
     void updateDefaultScheme();
@@ -147,6 +149,9 @@ private:
 
     QTemporaryDir m_extendedThemeDir;
     KConfigGroup m_themeGroup;
+    //! panel backgrounds analysis results per plasma theme, they are stored
+    //! in the cache location because they can always be recalculated
+    KSharedConfig::Ptr m_backgroundsCache;
     Plasma::Theme m_theme;
 
     PanelBackground *m_backgroundTopEdge{nullptr};
@@ -653,7 +653,7 @@ void Layouts::setId(const int &row, const QString &newId)
     roles << Qt::DisplayRole;
 
     QString oldId = m_layoutsTable[row].id;
-    m_layoutsTable[row].id = newId;
+    m_layoutsTable.setId(row, newId);
     emit dataChanged(index(row, NAMECOLUMN), index(row,NAMECOLUMN), roles);
 }
 
@@ -81,6 +81,10 @@ GlobalShortcuts::GlobalShortcuts(QObject *parent)
     }
 
     connect(&m_hideViewsTimer, &QTimer::timeout, this, &GlobalShortcuts::hideViewsTimerSlot);
+
+    m_badgesTimer.setInterval(16);
+    m_badgesTimer.setSingleShot(true);
+    connect(&m_badgesTimer, &QTimer::timeout, this, &GlobalShortcuts::updateViewItemBadges);
 }
 
 GlobalShortcuts::~GlobalShortcuts()
@@ -375,13 +379,26 @@ void GlobalShortcuts::activateEntry(int index, Qt::Key modifier)
 
 //! update badge for specific view item
 void GlobalShortcuts::updateViewItemBadge(QString identifier, QString value)
+{
+    m_pendingBadges[identifier] = value;
+
+    if (!m_badgesTimer.isActive()) {
+        m_badgesTimer.start();
+    }
+}
+
+void GlobalShortcuts::updateViewItemBadges()
 {
     QList<Latte::View *> views = m_corona->layoutsManager()->synchronizer()->currentViews();
 
     // update badges in all Latte Tasks plasmoids
-    for (const auto &view : views) {
-        view->extendedInterface()->updateBadgeForLatteTask(identifier, value);
+    for (auto badge = m_pendingBadges.constBegin(); badge != m_pendingBadges.constEnd(); ++badge) {
+        for (const auto &view : views) {
+            view->extendedInterface()->updateBadgeForLatteTask(badge.key(), badge.value());
+        }
     }
+
+    m_pendingBadges.clear();
 }
 
 void GlobalShortcuts::showViews()
@@ -26,6 +26,7 @@
 
 // Qt
 #include <QAction>
+#include <QHash>
 #include <QPointer>
 #include <QTimer>
 
@@ -66,6 +67,7 @@ signals:
 
 private slots:
     void hideViewsTimerSlot();
+    void updateViewItemBadges();
 
 private:
     void init();
@@ -98,6 +100,11 @@ private:
     QTimer m_hideViewsTimer;
     QList<Latte::View *> m_hideViews;
 
+    //! badges requested from external apps, only the last value of each
+    //! identifier is sent to views once per frame
+    QHash<QString, QString> m_pendingBadges;
+    QTimer m_badgesTimer;
+
     QPointer<ShortcutsPart::ModifierTracker> m_modifierTracker;
     QPointer<ShortcutsPart::ShortcutsTracker> m_shortcutsTracker;
     QPointer<Latte::Corona> m_corona;
@@ -58,8 +58,12 @@ ContainmentInterface::ContainmentInterface(Latte::View *parent)
 
     connect(m_view, &View::containmentChanged
             , this, [&]() {
+        invalidateAppletsIndex();
+
         if (m_view->containment()) {
             connect(m_view->containment(), &Plasma::Containment::appletAdded, this, &ContainmentInterface::onAppletAdded);
+            connect(m_view->containment(), &Plasma::Containment::appletAdded, this, &ContainmentInterface::invalidateAppletsIndex);
+            connect(m_view->containment(), &Plasma::Containment::appletRemoved, this, &ContainmentInterface::invalidateAppletsIndex);
 
             m_appletsExpandedConnectionsTimer.start();
         }
@@ -109,6 +113,87 @@ void ContainmentInterface::identifyMethods()
     m_showShortcutsMethod = m_shortcutsHost->metaObject()->method(sbIndex);
 }
 
+void ContainmentInterface::invalidateAppletsIndex()
+{
+    m_appletsIndexIsValid = false;
+}
+
+void ContainmentInterface::updateAppletsIndex() const
+{
+    m_appletsIndex.clear();
+    m_appletsIndexIsValid = true;
+
+    if (!m_view->containment()) {
+        return;
+    }
+
+    for (auto *applet : m_view->containment()->applets()) {
+        KPluginMetaData meta = applet->kPackage().metadata();
+        const auto &provides = KPluginMetaData::readStringList(applet->pluginMetaData().rawData(), QStringLiteral("X-Plasma-Provides"));
+
+        AppletCapabilitiesData data;
+        data.applet = applet;
+        data.pluginId = meta.pluginId();
+        data.isApplicationLauncher = provides.contains(QLatin1String("org.kde.plasma.launchermenu"));
+        data.isLatteTasks = (data.pluginId == "org.kde.latte.plasmoid");
+        data.isPlasmaTasks = provides.contains(QLatin1String("org.kde.plasma.multitasking"));
+
+        m_appletsIndex << data;
+    }
+}
+
+const QList<ContainmentInterface::AppletCapabilitiesData> &ContainmentInterface::appletsIndex() const
+{
+    if (!m_appletsIndexIsValid) {
+        updateAppletsIndex();
+    }
+
+    return m_appletsIndex;
+}
+
+QList<ContainmentInterface::AppletCapabilitiesData> &ContainmentInterface::appletsIndex()
+{
+    if (!m_appletsIndexIsValid) {
+        updateAppletsIndex();
+    }
+
+    return m_appletsIndex;
+}
+
+bool ContainmentInterface::resolveMethod(const AppletCapabilitiesData &data, MethodTarget &target, const char *signature) const
+{
+    if (target.item) {
+        return true;
+    }
+
+    QQuickItem *appletInterface = data.applet ? data.applet->property("_plasma_graphicObject").value<QQuickItem *>() : nullptr;
+
+    if (!appletInterface) {
+        return false;
+    }
+
+    for (QQuickItem *item : appletInterface->childItems()) {
+        if (auto *metaObject = item->metaObject()) {
+            // not using QMetaObject::invokeMethod to avoid warnings when calling
+            // this on applets that don't have it or other child items since this
+            // is pretty much trial and error.
+            // Also, "var" arguments are treated as QVariant in QMetaObject
+
+            int methodIndex = metaObject->indexOfMethod(signature);
+
+            if (methodIndex == -1) {
+                continue;
+            }
+
+            target.item = item;
+            target.method = metaObject->method(methodIndex);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool ContainmentInterface::applicationLauncherHasGlobalShortcut() const
 {
     if (!containsApplicationLauncher()) {
@@ -117,11 +202,9 @@ bool ContainmentInterface::applicationLauncherHasGlobalShortcut() const
 
     uint launcherAppletId = applicationLauncherId();
 
-    const auto applets = m_view->containment()->applets();
-
-    for (auto applet : applets) {
-        if (applet->id() == launcherAppletId) {
-            return !applet->globalShortcut().isEmpty();
+    for (const auto &data : appletsIndex()) {
+        if (data.applet && data.applet->id() == launcherAppletId) {
+            return !data.applet->globalShortcut().isEmpty();
         }
     }
 
@@ -137,11 +220,9 @@ bool ContainmentInterface::applicationLauncherInPopup() const
     uint launcherAppletId = applicationLauncherId();
     QString launcherPluginId;
 
-    const auto applets = m_view->containment()->applets();
-
-    for (auto applet : applets) {
-        if (applet->id() == launcherAppletId) {
-            launcherPluginId = applet->kPackage().metadata().pluginId();
+    for (const auto &data : appletsIndex()) {
+        if (data.applet && data.applet->id() == launcherAppletId) {
+            launcherPluginId = data.pluginId;
         }
     }
 
@@ -182,18 +263,14 @@ bool ContainmentInterface::isApplication(const QUrl &url) const
 
 int ContainmentInterface::applicationLauncherId() const
 {
-    const auto applets = m_view->containment()->applets();
-
     auto launcherId{-1};
 
-    for (auto applet : applets) {
-        const auto provides = applet->kPackage().metadata().value(QStringLiteral("X-Plasma-Provides"));
-
-        if (provides.contains(QLatin1String("org.kde.plasma.launchermenu"))) {
-            if (!applet->globalShortcut().isEmpty()) {
-                return applet->id();
+    for (const auto &data : appletsIndex()) {
+        if (data.applet && data.isApplicationLauncher) {
+            if (!data.applet->globalShortcut().isEmpty()) {
+                return data.applet->id();
             } else if (launcherId == -1) {
-                launcherId = applet->id();
+                launcherId = data.applet->id();
             }
         }
     }
@@ -207,41 +284,10 @@ bool ContainmentInterface::updateBadgeForLatteTask(const QString identifier, con
         return false;
     }
 
-    const auto &applets = m_view->containment()->applets();
-
-    for (auto *applet : applets) {
-        KPluginMetaData meta = applet->kPackage().metadata();
-
-        if (meta.pluginId() == "org.kde.latte.plasmoid") {
-
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
-
-                if (childItems.isEmpty()) {
-                    continue;
-                }
-
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        // not using QMetaObject::invokeMethod to avoid warnings when calling
-                        // this on applets that don't have it or other child items since this
-                        // is pretty much trial and error.
-                        // Also, "var" arguments are treated as QVariant in QMetaObject
-
-                        int methodIndex = metaObject->indexOfMethod("updateBadge(QVariant,QVariant)");
-
-                        if (methodIndex == -1) {
-                            continue;
-                        }
-
-                        QMetaMethod method = metaObject->method(methodIndex);
-
-                        if (method.invoke(item, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
-                            return true;
-                        }
-                    }
-                }
-            }
+    for (auto &data : appletsIndex()) {
+        if (data.isLatteTasks && resolveMethod(data, data.updateBadge, "updateBadge(QVariant,QVariant)")
+                && data.updateBadge.method.invoke(data.updateBadge.item, Q_ARG(QVariant, identifier), Q_ARG(QVariant, value))) {
+            return true;
         }
     }
 
@@ -256,39 +302,12 @@ bool ContainmentInterface::activatePlasmaTask(const int index)
         return false;
     }
 
-    const auto &applets = m_view->containment()->applets();
-
-    for (auto *applet : applets) {
-        const auto &provides = KPluginMetaData::readStringList(applet->pluginMetaData().rawData(), QStringLiteral("X-Plasma-Provides"));
-
-        if (provides.contains(QLatin1String("org.kde.plasma.multitasking"))) {
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
-
-                if (childItems.isEmpty()) {
-                    continue;
-                }
-
-                KPluginMetaData meta = applet->kPackage().metadata();
-
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        int methodIndex{metaObject->indexOfMethod("activateTaskAtIndex(QVariant)")};
-
-                        if (methodIndex == -1) {
-                            continue;
-                        }
-
-                        QMetaMethod method = metaObject->method(methodIndex);
-
-                        if (method.invoke(item, Q_ARG(QVariant, index - 1))) {
-                            showShortcutBadges(false, true);
+    for (auto &data : appletsIndex()) {
+        if (data.isPlasmaTasks && resolveMethod(data, data.activateTask, "activateTaskAtIndex(QVariant)")
+                && data.activateTask.method.invoke(data.activateTask.item, Q_ARG(QVariant, index - 1))) {
+            showShortcutBadges(false, true);
 
-                            return true;
-                        }
-                    }
-                }
-            }
+            return true;
         }
     }
 
@@ -303,39 +322,12 @@ bool ContainmentInterface::newInstanceForPlasmaTask(const int index)
         return false;
     }
 
-    const auto &applets = m_view->containment()->applets();
-
-    for (auto *applet : applets) {
-        const auto &provides = KPluginMetaData::readStringList(applet->pluginMetaData().rawData(), QStringLiteral("X-Plasma-Provides"));
-
-        if (provides.contains(QLatin1String("org.kde.plasma.multitasking"))) {
-            if (QQuickItem *appletInterface = applet->property("_plasma_graphicObject").value<QQuickItem *>()) {
-                const auto &childItems = appletInterface->childItems();
-
-                if (childItems.isEmpty()) {
-                    continue;
-                }
-
-                KPluginMetaData meta = applet->kPackage().metadata();
-
-                for (QQuickItem *item : childItems) {
-                    if (auto *metaObject = item->metaObject()) {
-                        int methodIndex{metaObject->indexOfMethod("newInstanceForTaskAtIndex(QVariant)")};
-
-                        if (methodIndex == -1) {
-                            continue;
-                        }
+    for (auto &data : appletsIndex()) {
+        if (data.isPlasmaTasks && resolveMethod(data, data.newInstanceForTask, "newInstanceForTaskAtIndex(QVariant)")
+                && data.newInstanceForTask.method.invoke(data.newInstanceForTask.item, Q_ARG(QVariant, index - 1))) {
+            showShortcutBadges(false, true);
 
-                        QMetaMethod method = metaObject->method(methodIndex);
-
-                        if (method.invoke(item, Q_ARG(QVariant, index - 1))) {
-                            showShortcutBadges(false, true);
-
-                            return true;
-                        }
-                    }
-                }
-            }
+            return true;
         }
     }
 
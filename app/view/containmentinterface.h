@@ -81,7 +81,8 @@ public:
     bool showOnlyMeta();
     bool showShortcutBadges(const bool showLatteShortcuts, const bool showMeta);
 
-    //! this is updated from external apps e.g. a thunderbird plugin
+    //! this is updated from external apps e.g. a thunderbird plugin, the receivers are
+    //! the latte tasks entries of the applets capabilities index
     bool updateBadgeForLatteTask(const QString identifier, const QString value);
 
     int applicationLauncherId() const;
@@ -126,6 +127,35 @@ private:
 
     bool appletIsExpandable(PlasmaQuick::AppletQuickItem *appletQuickItem);
 
+    void invalidateAppletsIndex();
+    void updateAppletsIndex() const;
+
+private:
+    struct MethodTarget {
+        QPointer<QQuickItem> item;
+        QMetaMethod method;
+    };
+
+    //! applet capabilities that are needed from global shortcuts and external
+    //! apps, they are identified once instead of on every request
+    struct AppletCapabilitiesData {
+        QPointer<Plasma::Applet> applet;
+        QString pluginId;
+        bool isApplicationLauncher{false};
+        bool isLatteTasks{false};
+        bool isPlasmaTasks{false};
+
+        //! resolved on first use because plasmoid contents are loaded later
+        MethodTarget activateTask;
+        MethodTarget newInstanceForTask;
+        MethodTarget updateBadge;
+    };
+
+    //! the index is rebuilt on demand, only its cached method targets are updated through the non const access
+    const QList<AppletCapabilitiesData> &appletsIndex() const;
+    QList<AppletCapabilitiesData> &appletsIndex();
+    bool resolveMethod(const AppletCapabilitiesData &data, MethodTarget &target, const char *signature) const;
+
 private:
     bool m_hasLatteTasks{false};
     bool m_hasPlasmaTasks{false};
@@ -149,6 +179,10 @@ private:
     //!keep record of applet ids and avoid crashes when trying to access ids for already destroyed applets
     QHash<PlasmaQuick::AppletQuickItem *, int> m_expandedAppletIds;
     QHash<PlasmaQuick::AppletQuickItem *, QMetaObject::Connection> m_appletsExpandedConnections;
+
+    //! applets capabilities index, in containment applets order
+    mutable bool m_appletsIndexIsValid{false};
+    mutable QList<AppletCapabilitiesData> m_appletsIndex;
 };
 
 }
@@ -28,6 +28,7 @@
 #include "../wm/abstractwindowinterface.h"
 
 // Qt
+#include <QList>
 #include <QRegion>
 
 // KDE
@@ -35,6 +36,21 @@
 #include <KWindowSystem>
 
 
+namespace {
+//! untranslated background masks shared between all views, most recently used first
+struct BackgroundMaskData {
+    QSize size;
+    int enabledBorders{0};
+    int radius{-1};
+    int corners{0};
+    QString themeName;
+    QRegion mask;
+};
+
+const int BACKGROUNDMASKSCACHESIZE = 16;
+QList<BackgroundMaskData> s_backgroundMasks;
+}
+
 namespace Latte {
 namespace ViewPart {
 
@@ -96,6 +112,8 @@ void Effects::init()
     connect(m_view, &Latte::View::configWindowGeometryChanged, this, &Effects::updateMask);
 
     connect(&m_theme, &Plasma::Theme::themeChanged, this, [&]() {
+        s_backgroundMasks.clear();
+
         auto background = m_background;
         m_background = new Plasma::FrameSvg(this);
 
@@ -318,7 +336,7 @@ void Effects::setInputMask(QRect area)
     m_inputMask = area;
 
     if (KWindowSystem::isPlatformX11()) {
-        m_corona->wm()->setInputMask(m_view, area);
+        m_corona->wm()->requestInputMask(m_view, area);
     } else {
         //under wayland mask() is providing the Input Area
         m_view->setMask(area);
@@ -329,6 +347,8 @@ void Effects::setInputMask(QRect area)
 
 void Effects::forceMaskRedraw()
 {
+    s_backgroundMasks.clear();
+
     if (m_background) {
         delete m_background;
     }
@@ -428,6 +448,74 @@ QRegion Effects::maskCombinedRegion()
     return region;
 }
 
+QRegion Effects::backgroundMask(const QSize &size)
+{
+    //! radius values that are not positive do not update the corners mask,
+    //! so their masks are not safe to share between views
+    bool cacheable = !m_backgroundRadiusEnabled || m_backgroundRadius > 0;
+
+    BackgroundMaskData data;
+    data.size = size;
+    data.themeName = m_theme.themeName();
+
+    if (m_backgroundRadiusEnabled) {
+        data.radius = m_backgroundRadius;
+        data.corners = (m_hasTopLeftCorner ? 0x1 : 0) | (m_hasTopRightCorner ? 0x2 : 0)
+                | (m_hasBottomRightCorner ? 0x4 : 0) | (m_hasBottomLeftCorner ? 0x8 : 0);
+    } else {
+        data.enabledBorders = (int)m_enabledBorders;
+    }
+
+    if (cacheable) {
+        for (int i = 0; i < s_backgroundMasks.count(); ++i) {
+            const BackgroundMaskData &cached = s_backgroundMasks[i];
+
+            if (cached.size == data.size
+                    && cached.enabledBorders == data.enabledBorders
+                    && cached.radius == data.radius
+                    && cached.corners == data.corners
+                    && cached.themeName == data.themeName) {
+                if (i > 0) {
+                    s_backgroundMasks.move(i, 0);
+                }
+
+                return s_backgroundMasks[0].mask;
+            }
+        }
+    }
+
+    if (m_backgroundRadiusEnabled) {
+        //! CustomBackground way
+        data.mask = customMask(QRect(QPoint(0, 0), size));
+    } else {
+        //! Plasma::Theme way
+        //! this is used when compositing is disabled and provides
+        //! the correct way for the mask to be painted in order for
+        //! rounded corners to be shown correctly
+        if (!m_background) {
+            m_background = new Plasma::FrameSvg(this);
+        }
+
+        if (m_background->imagePath() != "widgets/panel-background") {
+            m_background->setImagePath(QStringLiteral("widgets/panel-background"));
+        }
+
+        m_background->setEnabledBorders(m_enabledBorders);
+        m_background->resizeFrame(size);
+        data.mask = m_background->mask();
+    }
+
+    if (cacheable) {
+        s_backgroundMasks.prepend(data);
+
+        while (s_backgroundMasks.count() > BACKGROUNDMASKSCACHESIZE) {
+            s_backgroundMasks.removeLast();
+        }
+    }
+
+    return data.mask;
+}
+
 void Effects::updateBackgroundCorners()
 {
     if (m_backgroundRadius<=0) {
@@ -466,32 +554,7 @@ void Effects::updateMask()
 
         QRect maskRect = m_view->behaveAsPlasmaPanel() ? QRect(0,0, m_view->width(), m_view->height()) : m_mask;
 
-        if (m_backgroundRadiusEnabled) {
-            //! CustomBackground way
-            fixedMask = customMask(QRect(0,0,maskRect.width(), maskRect.height()));
-        } else {
-            //! Plasma::Theme way
-            //! this is used when compositing is disabled and provides
-            //! the correct way for the mask to be painted in order for
-            //! rounded corners to be shown correctly
-            //! the enabledBorders check was added because there was cases
-            //! that the mask region wasn't calculated correctly after location changes
-            if (!m_background) {
-                if (m_background && m_background->enabledBorders() != m_enabledBorders) {
-                    delete m_background;
-                }
-
-                m_background = new Plasma::FrameSvg(this);
-            }
-
-            if (m_background->imagePath() != "widgets/panel-background") {
-                m_background->setImagePath(QStringLiteral("widgets/panel-background"));
-            }
-
-            m_background->setEnabledBorders(m_enabledBorders);
-            m_background->resizeFrame(maskRect.size());
-            fixedMask = m_background->mask();
-        }
+        fixedMask = backgroundMask(maskRect.size());
 
         fixedMask.translate(maskRect.x(), maskRect.y());
 
@@ -531,29 +594,7 @@ void Effects::updateEffects()
     if (m_drawEffects) {
         if (!m_view->behaveAsPlasmaPanel()) {
             if (!m_rect.isNull() && !m_rect.isEmpty()) {
-                QRegion backMask;
-
-                if (m_backgroundRadiusEnabled) {
-                    //! CustomBackground way
-                    backMask = customMask(QRect(0,0,m_rect.width(), m_rect.height()));
-                } else {
-                    //! Plasma::Theme way
-                    //! this is used when compositing is disabled and provides
-                    //! the correct way for the mask to be painted in order for
-                    //! rounded corners to be shown correctly
-                    if (!m_background) {
-                        m_background = new Plasma::FrameSvg(this);
-                    }
-
-                    if (m_background->imagePath() != "widgets/panel-background") {
-                        m_background->setImagePath(QStringLiteral("widgets/panel-background"));
-                    }
-
-                    m_background->setEnabledBorders(m_enabledBorders);
-                    m_background->resizeFrame(m_rect.size());
-
-                    backMask = m_background->mask();
-                }
+                QRegion backMask = backgroundMask(m_rect.size());
 
                 //! adjust mask coordinates based on local coordinates
                 int fX = m_rect.x(); int fY = m_rect.y();
@@ -150,6 +150,8 @@ private:
     bool backgroundRadiusIsEnabled() const;
     qreal currentMidValue(const qreal &max, const qreal &factor, const qreal &min) const;
     QRegion customMask(const QRect &rect);
+    //! untranslated background mask for the given size, cached between views
+    QRegion backgroundMask(const QSize &size);
     QRegion maskCombinedRegion();
 
 private:
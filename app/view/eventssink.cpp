@@ -31,10 +31,26 @@
 #include <QPointF>
 #include <QRectF>
 
+// C++
+#include <algorithm>
+
 
 namespace Latte {
 namespace ViewPart {
 
+//! reuses the pooled event, it is created only the first time
+template <class T>
+static T *pooledEvent(T *&pooled, const T &event)
+{
+    if (!pooled) {
+        pooled = new T(event);
+    } else {
+        *pooled = event;
+    }
+
+    return pooled;
+}
+
 EventsSink::EventsSink(Latte::View *parent)
     : QObject(parent),
       m_view(parent)
@@ -43,6 +59,13 @@ EventsSink::EventsSink(Latte::View *parent)
 
 EventsSink::~EventsSink()
 {
+    delete m_sunkDragEnterEvent;
+    delete m_sunkDragMoveEvent;
+    delete m_sunkDropEvent;
+    delete m_sunkMouseMoveEvent;
+    delete m_sunkMousePressEvent;
+    delete m_sunkMouseReleaseEvent;
+    delete m_sunkWheelEvent;
 }
 
 QQuickItem *EventsSink::originParentItem() const
@@ -64,6 +87,8 @@ void EventsSink::setSink(QQuickItem *originParent, QQuickItem *destination)
     m_originParentItem = originParent;
     m_destinationItem = destination;
 
+    updateOriginConnections();
+
     emit itemsChanged();
 }
 
@@ -97,12 +122,11 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto de = static_cast<QDragEnterEvent *>(e)) {
             QPointF point = de->posF();
             if (originSinksContain(point)) {
-                auto de2 = new QDragEnterEvent(positionAdjustedForDestination(point).toPoint(),
-                                               de->possibleActions(),
-                                               de->mimeData(),
-                                               de->mouseButtons(),
-                                               de->keyboardModifiers());
-                sunkevent = de2;
+                sunkevent = pooledEvent(m_sunkDragEnterEvent, QDragEnterEvent(positionAdjustedForDestination(point).toPoint(),
+                                                                              de->possibleActions(),
+                                                                              de->mimeData(),
+                                                                              de->mouseButtons(),
+                                                                              de->keyboardModifiers()));
             } else if (!destinationContains(point)) {
                 release();
             }
@@ -113,13 +137,11 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto de = static_cast<QDragMoveEvent *>(e)) {
             QPointF point = de->posF();
             if (originSinksContain(point)) {
-                auto de2 = new QDragMoveEvent(positionAdjustedForDestination(point).toPoint(),
-                                              de->possibleActions(),
-                                              de->mimeData(),
-                                              de->mouseButtons(),
-                                              de->keyboardModifiers());
-
-                sunkevent = de2;
+                sunkevent = pooledEvent(m_sunkDragMoveEvent, QDragMoveEvent(positionAdjustedForDestination(point).toPoint(),
+                                                                            de->possibleActions(),
+                                                                            de->mimeData(),
+                                                                            de->mouseButtons(),
+                                                                            de->keyboardModifiers()));
             } else if (!destinationContains(point)) {
                 release();
             }
@@ -130,13 +152,11 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto de = static_cast<QDropEvent *>(e)) {
             QPointF point = de->posF();
             if (originSinksContain(point)) {
-                auto de2 = new QDropEvent(positionAdjustedForDestination(point).toPoint(),
-                                          de->possibleActions(),
-                                          de->mimeData(),
-                                          de->mouseButtons(),
-                                          de->keyboardModifiers());
-
-                sunkevent = de2;
+                sunkevent = pooledEvent(m_sunkDropEvent, QDropEvent(positionAdjustedForDestination(point).toPoint(),
+                                                                    de->possibleActions(),
+                                                                    de->mimeData(),
+                                                                    de->mouseButtons(),
+                                                                    de->keyboardModifiers()));
             } else if (!destinationContains(point)) {
                 release();
             }
@@ -148,13 +168,11 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
             if (m_view->positioner() && m_view->positioner()->isCursorInsideView() && originSinksContain(me->windowPos())) {
                 auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
-
-                sunkevent = me2;
+                sunkevent = pooledEvent(m_sunkMouseMoveEvent, QMouseEvent(me->type(),
+                                                                          positionadjusted,
+                                                                          positionadjusted,
+                                                                          positionadjusted + m_view->position(),
+                                                                          me->button(), me->buttons(), me->modifiers()));
             } else if (!destinationContains(me->windowPos())) {
                 release();
             }
@@ -165,14 +183,13 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
             if (originSinksContain(me->windowPos())) {
                 auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
+                sunkevent = pooledEvent(m_sunkMousePressEvent, QMouseEvent(me->type(),
+                                                                           positionadjusted,
+                                                                           positionadjusted,
+                                                                           positionadjusted + m_view->position(),
+                                                                           me->button(), me->buttons(), me->modifiers()));
 
                 qDebug() << "Sunk Event:: sunk event pressed...";
-                sunkevent = me2;
             } else if (!destinationContains(me->windowPos())) {
                 release();
             }
@@ -183,13 +200,11 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
             if (originSinksContain(me->windowPos())) {
                 auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
-
-                sunkevent = me2;
+                sunkevent = pooledEvent(m_sunkMouseReleaseEvent, QMouseEvent(me->type(),
+                                                                             positionadjusted,
+                                                                             positionadjusted,
+                                                                             positionadjusted + m_view->position(),
+                                                                             me->button(), me->buttons(), me->modifiers()));
             } else if (!destinationContains(me->windowPos())) {
                 release();
             }
@@ -206,12 +221,10 @@ QEvent *EventsSink::onEvent(QEvent *e)
 
             if (originSinksContain(pos)) {
                 auto positionadjusted = positionAdjustedForDestination(pos);
-                auto we2 = new QWheelEvent(positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           we->pixelDelta(), we->angleDelta(), we->angleDelta().y(),
-                                           we->orientation(), we->buttons(), we->modifiers(), we->phase());
-
-                sunkevent = we2;
+                sunkevent = pooledEvent(m_sunkWheelEvent, QWheelEvent(positionadjusted,
+                                                                      positionadjusted + m_view->position(),
+                                                                      we->pixelDelta(), we->angleDelta(), we->angleDelta().y(),
+                                                                      we->orientation(), we->buttons(), we->modifiers(), we->phase()));
             } else if (!destinationContains(pos)) {
                 release();
             }
@@ -239,16 +252,107 @@ bool EventsSink::destinationContains(const QPointF &point) const
     return destinationRectToScene.contains(point);
 }
 
-bool EventsSink::originSinksContain(const QPointF &point) const
+void EventsSink::invalidateOriginRects()
+{
+    m_originRectsAreValid = false;
+}
+
+void EventsSink::updateOriginConnections()
+{
+    for (const auto &connection : m_originConnections) {
+        disconnect(connection);
+    }
+
+    m_originConnections.clear();
+    invalidateOriginRects();
+
+    if (!m_originParentItem) {
+        return;
+    }
+
+    m_originConnections << connect(m_originParentItem, &QQuickItem::childrenChanged, this, &EventsSink::updateOriginConnections);
+
+    //! origin rects are tracked in originParentItem coordinates, so only children
+    //! geometry and transformations can invalidate them
+    for (const auto origin : m_originParentItem->childItems()) {
+        m_originConnections << connect(origin, &QQuickItem::xChanged, this, &EventsSink::invalidateOriginRects);
+        m_originConnections << connect(origin, &QQuickItem::yChanged, this, &EventsSink::invalidateOriginRects);
+        m_originConnections << connect(origin, &QQuickItem::widthChanged, this, &EventsSink::invalidateOriginRects);
+        m_originConnections << connect(origin, &QQuickItem::heightChanged, this, &EventsSink::invalidateOriginRects);
+        m_originConnections << connect(origin, &QQuickItem::scaleChanged, this, &EventsSink::invalidateOriginRects);
+        m_originConnections << connect(origin, &QQuickItem::rotationChanged, this, &EventsSink::invalidateOriginRects);
+    }
+}
+
+void EventsSink::updateOriginRects()
 {
-    QRegion originsRegion;
+    m_originRects.clear();
+    m_originRectsStart.clear();
+    m_originRectsMaxEnd.clear();
+
+    const QList<QQuickItem *> origins = m_originParentItem->childItems();
+
+    qreal minCenterX{0};
+    qreal maxCenterX{0};
+    qreal minCenterY{0};
+    qreal maxCenterY{0};
+
+    for (int i = 0; i < origins.count(); ++i) {
+        QRectF originGeometry = origins[i]->mapRectToItem(m_originParentItem, QRectF(0, 0, origins[i]->width(), origins[i]->height()));
+        m_originRects << originGeometry;
+
+        QPointF center = originGeometry.center();
+        minCenterX = (i == 0) ? center.x() : qMin(minCenterX, center.x());
+        maxCenterX = (i == 0) ? center.x() : qMax(maxCenterX, center.x());
+        minCenterY = (i == 0) ? center.y() : qMin(minCenterY, center.y());
+        maxCenterY = (i == 0) ? center.y() : qMax(maxCenterY, center.y());
+    }
+
+    //! origins are laid out along the main axis of the view
+    m_originRectsHorizontal = ((maxCenterX - minCenterX) >= (maxCenterY - minCenterY));
+
+    const bool horizontal = m_originRectsHorizontal;
+    std::sort(m_originRects.begin(), m_originRects.end(), [horizontal](const QRectF &a, const QRectF &b) {
+        return horizontal ? (a.left() < b.left()) : (a.top() < b.top());
+    });
+
+    qreal maxEnd{0};
+
+    for (int i = 0; i < m_originRects.count(); ++i) {
+        const QRectF &rect = m_originRects[i];
+        qreal end = horizontal ? rect.right() : rect.bottom();
+        maxEnd = (i == 0) ? end : qMax(maxEnd, end);
+
+        m_originRectsStart << (horizontal ? rect.left() : rect.top());
+        m_originRectsMaxEnd << maxEnd;
+    }
 
-    for(const auto currentOrigin: m_originParentItem->childItems()) {
-        QRectF currentOriginGeometry = currentOrigin->mapRectToScene(QRectF(0, 0, currentOrigin->width(), currentOrigin->height()));
-        originsRegion = originsRegion.united(currentOriginGeometry.toRect());
+    m_originRectsAreValid = true;
+}
+
+bool EventsSink::originSinksContain(const QPointF &point)
+{
+    if (!m_originRectsAreValid) {
+        updateOriginRects();
+    }
+
+    if (m_originRects.isEmpty()) {
+        return false;
+    }
+
+    QPointF originPoint = m_originParentItem->mapFromScene(point);
+    qreal pos = m_originRectsHorizontal ? originPoint.x() : originPoint.y();
+
+    //! last rect that starts before point and backwards only while previous rects can still reach it
+    int i = (std::upper_bound(m_originRectsStart.constBegin(), m_originRectsStart.constEnd(), pos) - m_originRectsStart.constBegin()) - 1;
+
+    for (; i >= 0 && m_originRectsMaxEnd[i] >= pos; --i) {
+        if (m_originRects[i].contains(originPoint)) {
+            return true;
+        }
     }
 
-    return originsRegion.contains(point.toPoint());
+    return false;
 }
 
 }
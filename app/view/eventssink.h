@@ -26,6 +26,13 @@
 #include <QList>
 #include <QPointer>
 #include <QQuickItem>
+#include <QVector>
+
+class QDragEnterEvent;
+class QDragMoveEvent;
+class QDropEvent;
+class QMouseEvent;
+class QWheelEvent;
 
 namespace Latte {
 class View;
@@ -66,16 +73,41 @@ signals:
 private slots:
     void release();
 
+    void invalidateOriginRects();
+    void updateOriginConnections();
+
 private:
     QPointF positionAdjustedForDestination(const QPointF &point) const;
 
-    bool originSinksContain(const QPointF &point) const;
+    bool originSinksContain(const QPointF &point);
     bool destinationContains(const QPointF &point) const;
+
+    void updateOriginRects();
+
 private:
     QPointer<Latte::View> m_view;
 
     QPointer<QQuickItem> m_originParentItem;
     QPointer<QQuickItem> m_destinationItem;
+
+    //! origin children rects in originParentItem coordinates, sorted by their start
+    //! at the main axis together with the maximum end of all previous rects
+    bool m_originRectsAreValid{false};
+    bool m_originRectsHorizontal{true};
+    QVector<QRectF> m_originRects;
+    QVector<qreal> m_originRectsStart;
+    QVector<qreal> m_originRectsMaxEnd;
+
+    QList<QMetaObject::Connection> m_originConnections;
+
+    //! sunk events are reused in order to avoid allocations for each event
+    QDragEnterEvent *m_sunkDragEnterEvent{nullptr};
+    QDragMoveEvent *m_sunkDragMoveEvent{nullptr};
+    QDropEvent *m_sunkDropEvent{nullptr};
+    QMouseEvent *m_sunkMouseMoveEvent{nullptr};
+    QMouseEvent *m_sunkMousePressEvent{nullptr};
+    QMouseEvent *m_sunkMouseReleaseEvent{nullptr};
+    QWheelEvent *m_sunkWheelEvent{nullptr};
 };
 
 }
@@ -66,6 +66,7 @@ public:
     void clearPixmaps();
     void setupPixmaps();
     Qt::HANDLE createPixmap(const QPixmap& source);
+    unsigned long x11Pixmap(const QPixmap &source);
     void initPixmap(const QString &element);
     QPixmap initEmptyPixmap(const QSize &size);
     void updateShadow(const QWindow *window, Plasma::FrameSvg::EnabledBorders);
@@ -98,6 +99,10 @@ public:
     //! graphical context
     xcb_gcontext_t _gc;
     bool m_isX11;
+
+    //! uploaded X11 pixmaps keyed by the cacheKey of their source pixmap, they are
+    //! shared by all enabled borders combinations and freed only on theme changes
+    QHash<qint64, unsigned long> m_x11Pixmaps;
 #endif
 
     struct Wayland {
@@ -152,11 +157,10 @@ void PanelShadows::addWindow(const QWindow *window, Plasma::FrameSvg::EnabledBor
 
     d->m_windows[window] = enabledBorders;
     d->updateShadow(window, enabledBorders);
+    //! uploaded pixmaps are kept when the last window is gone, so that
+    //! show/hide cycles of shadowed views do not upload them again
     connect(window, &QObject::destroyed, this, [this, window]() {
         d->m_windows.remove(window);
-        if (d->m_windows.isEmpty()) {
-            d->clearPixmaps();
-        }
     });
 }
 
@@ -169,10 +173,6 @@ void PanelShadows::removeWindow(const QWindow *window)
     d->m_windows.remove(window);
     disconnect(window, nullptr, this, nullptr);
     d->clearShadow(window);
-
-    if (d->m_windows.isEmpty()) {
-        d->clearPixmaps();
-    }
 }
 
 bool PanelShadows::hasShadows() const
@@ -272,6 +272,33 @@ Qt::HANDLE PanelShadows::Private::createPixmap(const QPixmap& source)
 
 }
 
+unsigned long PanelShadows::Private::x11Pixmap(const QPixmap &source)
+{
+#if HAVE_X11
+    if (source.isNull()) {
+        return 0;
+    }
+
+    const qint64 key = source.cacheKey();
+
+    if (m_x11Pixmaps.contains(key)) {
+        return m_x11Pixmaps[key];
+    }
+
+    const unsigned long pixmap = reinterpret_cast<unsigned long>(createPixmap(source));
+
+    //! failed pixmaps are not cached in order to be retried and never be freed
+    if (pixmap) {
+        m_x11Pixmaps[key] = pixmap;
+    }
+
+    return pixmap;
+#else
+    Q_UNUSED(source)
+    return 0;
+#endif
+}
+
 void PanelShadows::Private::initPixmap(const QString &element)
 {
     m_shadowPixmaps << q->pixmap(element);
@@ -330,78 +357,78 @@ void PanelShadows::Private::setupData(Plasma::FrameSvg::EnabledBorders enabledBo
     }
     //shadow-top
     if (enabledBorders & Plasma::FrameSvg::TopBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[0]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[0]);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyHorizontalPix));
+        data[enabledBorders] << x11Pixmap(m_emptyHorizontalPix);
     }
 
     //shadow-topright
     if (enabledBorders & Plasma::FrameSvg::TopBorder &&
         enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[1]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[1]);
     } else if (enabledBorders & Plasma::FrameSvg::TopBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerTopPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerTopPix);
     } else if (enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerRightPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerRightPix);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerPix);
     }
 
     //shadow-right
     if (enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[2]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[2]);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyVerticalPix));
+        data[enabledBorders] << x11Pixmap(m_emptyVerticalPix);
     }
 
     //shadow-bottomright
     if (enabledBorders & Plasma::FrameSvg::BottomBorder &&
         enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[3]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[3]);
     } else if (enabledBorders & Plasma::FrameSvg::BottomBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerBottomPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerBottomPix);
     } else if (enabledBorders & Plasma::FrameSvg::RightBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerRightPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerRightPix);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerPix);
     }
 
     //shadow-bottom
     if (enabledBorders & Plasma::FrameSvg::BottomBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[4]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[4]);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyHorizontalPix));
+        data[enabledBorders] << x11Pixmap(m_emptyHorizontalPix);
     }
 
     //shadow-bottomleft
     if (enabledBorders & Plasma::FrameSvg::BottomBorder &&
         enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[5]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[5]);
     } else if (enabledBorders & Plasma::FrameSvg::BottomBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerBottomPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerBottomPix);
     } else if (enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerLeftPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerLeftPix);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerPix);
     }
 
     //shadow-left
     if (enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[6]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[6]);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyVerticalPix));
+        data[enabledBorders] << x11Pixmap(m_emptyVerticalPix);
     }
 
     //shadow-topleft
     if (enabledBorders & Plasma::FrameSvg::TopBorder &&
         enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[7]));
+        data[enabledBorders] << x11Pixmap(m_shadowPixmaps[7]);
     } else if (enabledBorders & Plasma::FrameSvg::TopBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerTopPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerTopPix);
     } else if (enabledBorders & Plasma::FrameSvg::LeftBorder) {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerLeftPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerLeftPix);
     } else {
-        data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
+        data[enabledBorders] << x11Pixmap(m_emptyCornerPix);
     }
 #endif
 
@@ -467,33 +494,11 @@ void PanelShadows::Private::freeX11Pixmaps()
         return;
     }
 
-    foreach (const QPixmap &pixmap, m_shadowPixmaps) {
-        if (!pixmap.isNull()) {
-            XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(pixmap)));
-        }
+    for (const auto pixmap : m_x11Pixmaps) {
+        XFreePixmap(display, pixmap);
     }
 
-    if (!m_emptyCornerPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix)));
-    }
-    if (!m_emptyCornerBottomPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerBottomPix)));
-    }
-    if (!m_emptyCornerLeftPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerLeftPix)));
-    }
-    if (!m_emptyCornerRightPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerRightPix)));
-    }
-    if (!m_emptyCornerTopPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerTopPix)));
-    }
-    if (!m_emptyVerticalPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyVerticalPix)));
-    }
-    if (!m_emptyHorizontalPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyHorizontalPix)));
-    }
+    m_x11Pixmaps.clear();
 #endif
 }
 
@@ -399,6 +399,13 @@ void View::availableScreenRectChangedFromSlot(View *origin)
         return;
     }
 
+    //! vertical views always ignore left and right edges when positioning,
+    //! so a vertical origin can not change their geometry and syncing here
+    //! only cascades relayouts between vertical views
+    if (origin->formFactor() == Plasma::Types::Vertical) {
+        return;
+    }
+
     if (formFactor() == Plasma::Types::Vertical
             && origin->layout()
             && m_layout
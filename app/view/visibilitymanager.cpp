@@ -167,6 +167,7 @@ VisibilityManager::VisibilityManager(PlasmaQuick::ContainmentView *view)
 VisibilityManager::~VisibilityManager()
 {
     qDebug() << "VisibilityManager deleting...";
+    m_wm->forgetWindowProperties(m_latteView);
     m_wm->removeViewStruts(*m_latteView);
 
     if (m_edgeGhostWindow) {
@@ -241,7 +242,7 @@ void VisibilityManager::setMode(Latte::Types::Visibility mode)
 
     if (m_mode == Types::AlwaysVisible) {
         //! remove struts for old always visible mode
-        m_wm->removeViewStruts(*m_latteView);
+        m_wm->requestRemoveViewStruts(m_latteView);
     }
 
     m_timerShow.stop();
@@ -399,11 +400,11 @@ void VisibilityManager::updateStrutsBasedOnLayoutsAndActivities(bool forceUpdate
             //! though they should not. In such case setting struts when the windows are hidden
             //! the struts do not take any effect
             m_publishedStruts = computedStruts;
-            m_wm->setViewStruts(*m_latteView, m_publishedStruts, m_latteView->location());
+            m_wm->requestViewStruts(m_latteView, m_publishedStruts, m_latteView->location(), forceUpdate);
         }
     } else {
         m_publishedStruts = QRect();
-        m_wm->removeViewStruts(*m_latteView);
+        m_wm->requestRemoveViewStruts(m_latteView);
     }
 }
 
@@ -582,10 +583,10 @@ void VisibilityManager::publishFrameExtents(bool forceUpdate)
             //! When a view returns its frame extents to zero then that triggers a compositor
             //! strange behavior that moves/hides the view totally and freezes entire Latte
             //! this is why we have blocked that setting
-            m_wm->setFrameExtents(m_latteView, frameExtents);
+            m_wm->requestFrameExtents(m_latteView, frameExtents, forceUpdate);
         } else if (m_latteView->behaveAsPlasmaPanel()) {
             QMargins panelExtents(0, 0, 0, 0);
-            m_wm->setFrameExtents(m_latteView, panelExtents);
+            m_wm->requestFrameExtents(m_latteView, panelExtents, forceUpdate);
             emit frameExtentsCleared();
         }
     }
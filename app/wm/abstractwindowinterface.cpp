@@ -26,6 +26,7 @@
 #include "../lattecorona.h"
 
 // Qt
+#include <QCoreApplication>
 #include <QDebug>
 
 // KDE
@@ -36,6 +37,7 @@ namespace WindowSystem {
 
 #define MAXPLASMAPANELTHICKNESS 96
 #define MAXSIDEPANELTHICKNESS 512
+#define WINDOWPROPERTIESINTERVAL 16
 
 AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
     : QObject(parent)
@@ -60,6 +62,12 @@ AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
 
     connect(this, &AbstractWindowInterface::windowRemoved, this, &AbstractWindowInterface::windowRemovedSlot);
 
+    m_debugWindowProperties = (QCoreApplication::arguments().contains("-d") && QCoreApplication::arguments().contains("--input"));
+
+    m_windowPropertiesTimer.setInterval(WINDOWPROPERTIESINTERVAL);
+    m_windowPropertiesTimer.setSingleShot(true);
+    connect(&m_windowPropertiesTimer, &QTimer::timeout, this, &AbstractWindowInterface::flushWindowProperties);
+
     // connect(this, &AbstractWindowInterface::windowChanged, this, [&](WindowId wid) {
     //     qDebug() << "WINDOW CHANGED ::: " << wid;
     // });
@@ -74,6 +82,7 @@ AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
 AbstractWindowInterface::~AbstractWindowInterface()
 {
     m_windowWaitingTimer.stop();
+    m_windowPropertiesTimer.stop();
 
     m_schemesTracker->deleteLater();
     m_windowsTracker->deleteLater();
@@ -327,6 +336,190 @@ void AbstractWindowInterface::considerWindowChanged(WindowId wid)
     }
 }
 
+//! Window properties pipeline
+AbstractWindowInterface::WindowPropertiesData &AbstractWindowInterface::windowPropertiesData(QWindow *window)
+{
+    if (!m_windowProperties.contains(window)) {
+        WindowPropertiesData data;
+        data.window = window;
+        m_windowProperties[window] = data;
+
+        connect(window, &QObject::destroyed, this, [&, window]() {
+            m_windowProperties.remove(window);
+        });
+    }
+
+    return m_windowProperties[window];
+}
+
+void AbstractWindowInterface::scheduleWindowPropertiesFlush()
+{
+    if (!m_windowPropertiesTimer.isActive()) {
+        m_windowPropertiesTimer.start();
+    }
+}
+
+void AbstractWindowInterface::requestInputMask(QWindow *window, const QRect &rect)
+{
+    if (!window) {
+        return;
+    }
+
+    m_windowPropertiesRequests++;
+    WindowPropertiesData &data = windowPropertiesData(window);
+
+    if ((data.inputMaskPending && data.inputMask == rect)
+            || (!data.inputMaskPending && data.inputMaskApplied && data.appliedInputMask == rect)) {
+        m_windowPropertiesDropped++;
+        return;
+    }
+
+    data.inputMask = rect;
+    data.inputMaskPending = true;
+    scheduleWindowPropertiesFlush();
 }
+
+void AbstractWindowInterface::requestFrameExtents(QWindow *window, const QMargins &margins, bool forceUpdate)
+{
+    if (!window) {
+        return;
+    }
+
+    m_windowPropertiesRequests++;
+    WindowPropertiesData &data = windowPropertiesData(window);
+
+    if (!forceUpdate
+            && ((data.frameExtentsPending && data.frameExtents == margins)
+                || (!data.frameExtentsPending && data.frameExtentsApplied && data.appliedFrameExtents == margins))) {
+        m_windowPropertiesDropped++;
+        return;
+    }
+
+    if (forceUpdate) {
+        data.frameExtentsApplied = false;
+    }
+
+    data.frameExtents = margins;
+    data.frameExtentsPending = true;
+    scheduleWindowPropertiesFlush();
 }
 
+void AbstractWindowInterface::requestViewStruts(QWindow *window, const QRect &rect, Plasma::Types::Location location, bool forceUpdate)
+{
+    if (!window) {
+        return;
+    }
+
+    m_windowPropertiesRequests++;
+    WindowPropertiesData &data = windowPropertiesData(window);
+
+    if (!forceUpdate
+            && ((data.strutsPending && data.struts == rect && data.strutsLocation == location)
+                || (!data.strutsPending && data.strutsApplied && data.appliedStruts == rect && data.appliedStrutsLocation == location))) {
+        m_windowPropertiesDropped++;
+        return;
+    }
+
+    if (forceUpdate) {
+        data.strutsApplied = false;
+    }
+
+    data.struts = rect;
+    data.strutsLocation = location;
+    data.strutsPending = true;
+    scheduleWindowPropertiesFlush();
+}
+
+void AbstractWindowInterface::requestRemoveViewStruts(QWindow *window, bool forceUpdate)
+{
+    requestViewStruts(window, QRect(), Plasma::Types::Floating, forceUpdate);
+}
+
+void AbstractWindowInterface::forgetWindowProperties(QWindow *window)
+{
+    if (!m_windowProperties.contains(window)) {
+        return;
+    }
+
+    //! the entry is kept in order to not track the window destruction twice
+    WindowPropertiesData data;
+    data.window = window;
+    m_windowProperties[window] = data;
+}
+
+void AbstractWindowInterface::flushWindowProperties()
+{
+    QMutableHashIterator<QWindow *, WindowPropertiesData> i(m_windowProperties);
+
+    while (i.hasNext()) {
+        i.next();
+        WindowPropertiesData &data = i.value();
+
+        if (!data.window) {
+            i.remove();
+            continue;
+        }
+
+        if (data.inputMaskPending) {
+            data.inputMaskPending = false;
+
+            if (!data.inputMaskApplied || data.appliedInputMask != data.inputMask) {
+                setInputMask(data.window, data.inputMask);
+                m_windowPropertiesApplied++;
+            }
+
+            //! hidden windows ignore input masks, so they must be sent again when shown
+            data.inputMaskApplied = data.window->isVisible();
+            data.appliedInputMask = data.inputMask;
+        }
+
+        if (data.frameExtentsPending) {
+            data.frameExtentsPending = false;
+
+            if (!data.frameExtentsApplied || data.appliedFrameExtents != data.frameExtents) {
+                setFrameExtents(data.window, data.frameExtents);
+                m_windowPropertiesApplied++;
+            }
+
+            data.frameExtentsApplied = true;
+            data.appliedFrameExtents = data.frameExtents;
+        }
+
+        if (data.strutsPending) {
+            data.strutsPending = false;
+
+            if (!data.strutsApplied || data.appliedStruts != data.struts || data.appliedStrutsLocation != data.strutsLocation) {
+                if (data.struts.isNull()) {
+                    removeViewStruts(*data.window);
+                } else {
+                    setViewStruts(*data.window, data.struts, data.strutsLocation);
+                }
+
+                m_windowPropertiesApplied++;
+            }
+
+            data.strutsApplied = true;
+            data.appliedStruts = data.struts;
+            data.appliedStrutsLocation = data.strutsLocation;
+        }
+    }
+
+    if (m_debugWindowProperties) {
+        if (!m_windowPropertiesStatisticsTimer.isValid()) {
+            m_windowPropertiesStatisticsTimer.start();
+        } else if (m_windowPropertiesStatisticsTimer.elapsed() >= 1000) {
+            qreal seconds = m_windowPropertiesStatisticsTimer.elapsed() / 1000.0;
+            qDebug() << "window properties per second :: requested:" << m_windowPropertiesRequests / seconds
+                     << " dropped:" << m_windowPropertiesDropped / seconds
+                     << " applied:" << m_windowPropertiesApplied / seconds;
+
+            m_windowPropertiesRequests = 0;
+            m_windowPropertiesDropped = 0;
+            m_windowPropertiesApplied = 0;
+            m_windowPropertiesStatisticsTimer.restart();
+        }
+    }
+}
+
+}
+}
@@ -36,7 +36,10 @@
 #include <QObject>
 #include <QWindow>
 #include <QDialog>
+#include <QElapsedTimer>
+#include <QHash>
 #include <QMap>
+#include <QMargins>
 #include <QRect>
 #include <QPoint>
 #include <QPointer>
@@ -140,6 +143,16 @@ public:
     virtual void setFrameExtents(QWindow *view, const QMargins &margins) = 0;
     virtual void setInputMask(QWindow *window, const QRect &rect) = 0;
 
+    //! Window properties pipeline, identical requests are dropped and the rest
+    //! are coalesced and applied together once per frame
+    void requestInputMask(QWindow *window, const QRect &rect);
+    void requestFrameExtents(QWindow *window, const QMargins &margins, bool forceUpdate = false);
+    void requestViewStruts(QWindow *window, const QRect &rect, Plasma::Types::Location location, bool forceUpdate = false);
+    void requestRemoveViewStruts(QWindow *window, bool forceUpdate = false);
+    //! drops any pending request for window, must be called before applying
+    //! its properties directly e.g. when it is going to be deleted
+    void forgetWindowProperties(QWindow *window);
+
     Latte::Corona *corona();
     Tracker::Schemes *schemesTracker();
     Tracker::Windows *windowsTracker() const;
@@ -190,8 +203,46 @@ protected:
 
 private slots:
     void windowRemovedSlot(WindowId wid);
+    void flushWindowProperties();
+
+private:
+    struct WindowPropertiesData {
+        QPointer<QWindow> window;
+
+        bool inputMaskPending{false};
+        bool inputMaskApplied{false};
+        QRect inputMask;
+        QRect appliedInputMask;
+
+        bool frameExtentsPending{false};
+        bool frameExtentsApplied{false};
+        QMargins frameExtents;
+        QMargins appliedFrameExtents;
+
+        //! null struts rect means that struts must be removed
+        bool strutsPending{false};
+        bool strutsApplied{false};
+        QRect struts;
+        QRect appliedStruts;
+        Plasma::Types::Location strutsLocation{Plasma::Types::Floating};
+        Plasma::Types::Location appliedStrutsLocation{Plasma::Types::Floating};
+    };
+
+    WindowPropertiesData &windowPropertiesData(QWindow *window);
+    void scheduleWindowPropertiesFlush();
 
 private:
+    bool m_debugWindowProperties{false};
+
+    //! statistics for profiling, reported every second in debug mode
+    int m_windowPropertiesRequests{0};
+    int m_windowPropertiesDropped{0};
+    int m_windowPropertiesApplied{0};
+    QElapsedTimer m_windowPropertiesStatisticsTimer;
+
+    QHash<QWindow *, WindowPropertiesData> m_windowProperties;
+    QTimer m_windowPropertiesTimer;
+
     Latte::Corona *m_corona;
     Tracker::Schemes *m_schemesTracker;
     Tracker::Windows *m_windowsTracker;
@@ -50,6 +50,9 @@ XWindowInterface::XWindowInterface(QObject *parent)
 {
     m_currentDesktop = QString(KWindowSystem::self()->currentDesktop());
 
+    //! request shape extension data early so that input masks do not block on it
+    xcb_prefetch_extension_data(QX11Info::connection(), &xcb_shape_id);
+
     connect(KWindowSystem::self(), &KWindowSystem::activeWindowChanged, this, &AbstractWindowInterface::activeWindowChanged);
     connect(KWindowSystem::self(), &KWindowSystem::windowRemoved, this, &AbstractWindowInterface::windowRemoved);
 
@@ -357,17 +360,23 @@ void XWindowInterface::setFrameExtents(QWindow *view, const QMargins &margins)
     if (margins.isNull()) {
         //! delete property
         xcb_connection_t *c = QX11Info::connection();
-        const QByteArray atomName = QByteArrayLiteral("_GTK_FRAME_EXTENTS");
-        xcb_intern_atom_cookie_t atomCookie = xcb_intern_atom_unchecked(c, false, atomName.length(), atomName.constData());
-        QScopedPointer<xcb_intern_atom_reply_t, QScopedPointerPodDeleter> atom(xcb_intern_atom_reply(c, atomCookie, nullptr));
 
-        if (!atom) {
-            return;
+        if (m_gtkFrameExtentsAtom == XCB_ATOM_NONE) {
+            //! the atom is resolved only once, it does not change during the session
+            const QByteArray atomName = QByteArrayLiteral("_GTK_FRAME_EXTENTS");
+            xcb_intern_atom_cookie_t atomCookie = xcb_intern_atom_unchecked(c, false, atomName.length(), atomName.constData());
+            QScopedPointer<xcb_intern_atom_reply_t, QScopedPointerPodDeleter> atom(xcb_intern_atom_reply(c, atomCookie, nullptr));
+
+            if (!atom) {
+                return;
+            }
+
+            m_gtkFrameExtentsAtom = atom->atom;
         }
 
         // qDebug() << "   deleting gtk frame extents atom..";
 
-        xcb_delete_property(c, view->winId(), atom->atom);
+        xcb_delete_property(c, view->winId(), m_gtkFrameExtentsAtom);
     } else {
         NETStrut struts;
         struts.left = margins.left();
@@ -104,6 +104,9 @@ private:
     //xcb_shape
     bool m_shapeExtensionChecked{false};
     bool m_shapeAvailable{false};
+
+    //! _GTK_FRAME_EXTENTS atom, 0 is XCB_ATOM_NONE
+    uint m_gtkFrameExtentsAtom{0};
 };
 
 }
@@ -0,0 +1,160 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// local
+#include "data/appletdata.h"
+
+// Qt
+#include <QtTest>
+
+using Latte::Data::Applet;
+using Latte::Data::AppletsTable;
+
+class GenericTableBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void lookupsAfterEdits();
+
+    void indexOf_data();
+    void indexOf();
+    void compare_data();
+    void compare();
+    void lookupThenWrite_data();
+    void lookupThenWrite();
+
+private:
+    void addRowsColumn();
+    AppletsTable table(const int rows) const;
+};
+
+AppletsTable GenericTableBenchmark::table(const int rows) const
+{
+    AppletsTable applets;
+
+    for (int i=0; i<rows; ++i) {
+        Applet applet;
+        applet.id = QStringLiteral("org.kde.applet.%1").arg(i);
+        applet.name = QStringLiteral("Applet %1").arg(i);
+        applets << applet;
+    }
+
+    return applets;
+}
+
+void GenericTableBenchmark::addRowsColumn()
+{
+    QTest::addColumn<int>("rows");
+
+    QTest::newRow("100") << 100;
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("5000") << 5000;
+}
+
+void GenericTableBenchmark::lookupsAfterEdits()
+{
+    AppletsTable applets = table(10);
+
+    //! in place edits through references must not break lookups
+    applets[QStringLiteral("org.kde.applet.3")].name = QStringLiteral("Renamed");
+    QVERIFY(applets.containsName(QStringLiteral("Renamed")));
+    QVERIFY(!applets.containsName(QStringLiteral("Applet 3")));
+    QCOMPARE(applets.idForName(QStringLiteral("Renamed")), QStringLiteral("org.kde.applet.3"));
+
+    applets.setId(3, QStringLiteral("org.kde.renamed"));
+    QCOMPARE(applets.indexOf(QStringLiteral("org.kde.renamed")), 3);
+    QVERIFY(!applets.containsId(QStringLiteral("org.kde.applet.3")));
+
+    applets.remove(QStringLiteral("org.kde.applet.0"));
+    QCOMPARE(applets.indexOf(QStringLiteral("org.kde.renamed")), 2);
+
+    Applet first;
+    first.id = QStringLiteral("org.kde.first");
+    applets.insert(0, first);
+    QCOMPARE(applets.indexOf(QStringLiteral("org.kde.first")), 0);
+    QCOMPARE(applets.indexOf(QStringLiteral("org.kde.renamed")), 3);
+
+    AppletsTable copied = applets;
+    QVERIFY(copied == applets);
+    copied[QStringLiteral("org.kde.first")].name = QStringLiteral("Changed");
+    QVERIFY(copied != applets);
+}
+
+void GenericTableBenchmark::indexOf_data()
+{
+    addRowsColumn();
+}
+
+void GenericTableBenchmark::indexOf()
+{
+    QFETCH(int, rows);
+    AppletsTable applets = table(rows);
+    const QString last = QStringLiteral("org.kde.applet.%1").arg(rows - 1);
+
+    QBENCHMARK {
+        QCOMPARE(applets.indexOf(last), rows - 1);
+        QVERIFY(!applets.containsId(QStringLiteral("org.kde.missing")));
+    }
+}
+
+void GenericTableBenchmark::compare_data()
+{
+    addRowsColumn();
+}
+
+void GenericTableBenchmark::compare()
+{
+    QFETCH(int, rows);
+    const AppletsTable applets = table(rows);
+    const AppletsTable copied = table(rows);
+
+    QBENCHMARK {
+        QVERIFY(applets == copied);
+    }
+}
+
+void GenericTableBenchmark::lookupThenWrite_data()
+{
+    addRowsColumn();
+}
+
+void GenericTableBenchmark::lookupThenWrite()
+{
+    QFETCH(int, rows);
+    AppletsTable applets = table(rows);
+
+    QStringList ids;
+
+    for (int i=0; i<rows; ++i) {
+        ids << QStringLiteral("org.kde.applet.%1").arg(i);
+    }
+
+    QBENCHMARK {
+        for (const auto &id : ids) {
+            if (applets.containsId(id)) {
+                applets[id].description = id;
+            }
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(GenericTableBenchmark)
+
+#include "generictablebenchmark.moc"
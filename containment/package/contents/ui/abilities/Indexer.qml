@@ -46,33 +46,6 @@ Ability.IndexerPrivate {
     }
 
     function appletIdForVisibleIndex(itemVisibleIndex) {
-        var sLayout = layouts.startLayout;
-        for (var i=0; i<sLayout.children.length; ++i){
-            var appletItem = sLayout.children[i];
-
-            if (visibleIndexBelongsAtApplet(appletItem, itemVisibleIndex)) {
-                return appletItem.index;
-            }
-        }
-
-        var mLayout = layouts.mainLayout;
-        for (var i=0; i<mLayout.children.length; ++i){
-            var appletItem = sLayout.children[i];
-
-            if (visibleIndexBelongsAtApplet(appletItem, itemVisibleIndex)) {
-                return appletItem.index;
-            }
-        }
-
-        var eLayout = layouts.endLayout;
-        for (var i=0; i<eLayout.children.length; ++i){
-            var appletItem = sLayout.children[i];
-
-            if (visibleIndexBelongsAtApplet(appletItem, itemVisibleIndex)) {
-                return appletItem.index;
-            }
-        }
-
-        return -1;
+        return appletIndexForVisibleIndex(itemVisibleIndex);
     }
 }
@@ -22,6 +22,8 @@ import org.kde.plasma.plasmoid 2.0
 
 import org.kde.latte.abilities.definition 0.1 as AbilityDefinition
 
+import org.kde.latte.private.containment 0.1 as LatteContainment
+
 AbilityDefinition.Indexer {
     id: indxr
     property Item layouts: null
@@ -30,6 +32,65 @@ AbilityDefinition.Indexer {
     property var clients: []
     property var clientsBridges: []
 
+    LatteContainment.VisibleIndexer {
+        id: visibleIndexer
+        separators: indxr.separators
+        hidden: indxr.hidden
+    }
+
+    Binding{
+        target: visibleIndexer
+        property: "applets"
+        when: !updateIsBlocked
+        value: {
+            var aplts = [];
+
+            var sLayout = layouts.startLayout;
+            for (var i=0; i<sLayout.children.length; ++i){
+                var appletItem = sLayout.children[i];
+                if (appletItem && appletItem.index>=0) {
+                    aplts.push(appletItem.index);
+                }
+            }
+
+            var mLayout = layouts.mainLayout;
+            for (var i=0; i<mLayout.children.length; ++i){
+                var appletItem = mLayout.children[i];
+                if (appletItem && appletItem.index>=0) {
+                    aplts.push(appletItem.index);
+                }
+            }
+
+            var eLayout = layouts.endLayout;
+            for (var i=0; i<eLayout.children.length; ++i){
+                var appletItem = eLayout.children[i];
+                if (appletItem && appletItem.index>=0) {
+                    aplts.push(appletItem.index);
+                }
+            }
+
+            return aplts;
+        }
+    }
+
+    Binding{
+        target: visibleIndexer
+        property: "clientsItemsCounts"
+        when: !updateIsBlocked
+        value: {
+            var counts = {};
+
+            for (var i=0; i<clientsBridges.length; ++i) {
+                var bridge = clientsBridges[i];
+                if (bridge.client) {
+                    counts[bridge.appletIndex] = bridge.client.visibleItemsCount;
+                }
+            }
+
+            return counts;
+        }
+    }
+
     Binding{
         target: indxr
         property: "separators"
@@ -194,38 +255,18 @@ AbilityDefinition.Indexer {
         }
     }
 
-    function visibleItemsBeforeCount(layout, actualIndex) {
-        var visibleItems = 0;
-
-        for (var i=0; i<layout.children.length; ++i){
-            var appletItem = layout.children[i];
-            if (appletItem && appletItem.index<actualIndex) {
-                if ((separators.indexOf(appletItem.index) >= 0) || (hidden.indexOf(appletItem.index) >= 0)) {
-                    //! ignore hidden and separators applets
-                    continue;
-                } else if (!appletItem.communicator || !appletItem.communicator.indexerIsSupported) {
-                    //! single item applet
-                    visibleItems = visibleItems + 1;
-                } else if (appletItem.communicator && appletItem.communicator.indexerIsSupported) {
-                    //! multi items applet
-                    visibleItems = visibleItems + appletItem.communicator.bridge.indexer.client.visibleItemsCount;
-                }
-            }
-        }
-
-        return visibleItems;
+    function visibleItemsBeforeCount(actualIndex) {
+        //! reading visibleItemsCount keeps bindings that use this function updated
+        return visibleIndexer.visibleItemsCount >= 0 ? visibleIndexer.visibleItemsBeforeCount(actualIndex) : 0;
     }
 
     function visibleIndex(actualIndex) {
-        if ((separators.indexOf(actualIndex) >= 0) || (hidden.indexOf(actualIndex) >= 0)) {
-            return -1;
-        }
-
-        var visibleItems = visibleItemsBeforeCount(layouts.startLayout, actualIndex) +
-                visibleItemsBeforeCount(layouts.mainLayout, actualIndex) +
-                visibleItemsBeforeCount(layouts.endLayout, actualIndex);
+        //! reading visibleItemsCount keeps bindings that use this function updated
+        return visibleIndexer.visibleItemsCount >= 0 ? visibleIndexer.visibleIndex(actualIndex) : -1;
+    }
 
-        return visibleItems + 1;
+    function appletIndexForVisibleIndex(itemVisibleIndex) {
+        return visibleIndexer.visibleItemsCount >= 0 ? visibleIndexer.appletIndexForVisibleIndex(itemVisibleIndex) : -1;
     }
 
     function visibleIndexBelongsAtApplet(applet, itemVisibleIndex) {
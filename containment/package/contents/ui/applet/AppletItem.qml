@@ -60,7 +60,6 @@ Item {
     readonly property color highlightColor: theme.buttonFocusColor
 
     //! Fill Applet(s)
-    property bool inFillCalculations: false //temp record, is used in calculations for fillWidth,fillHeight applets
     property bool isAutoFillApplet:  isRequestingFill
 
     property bool isRequestingFill: {
@@ -30,8 +30,7 @@ import org.kde.plasma.components 2.0 as PlasmaComponents
 import org.kde.kquickcontrolsaddons 2.0
 
 import org.kde.latte.core 0.2 as LatteCore
-
-import "../colorizer" as Colorizer
+import org.kde.latte.private.containment 0.1 as LatteContainment
 
 BackgroundProperties{
     id:barLine
@@ -181,7 +180,6 @@ BackgroundProperties{
     readonly property bool customShadowedRectangleIsEnabled: customRadiusIsEnabled || (customDefShadowIsEnabled || customUserShadowIsEnabled)
 
     readonly property bool customShadowIsSupported: LatteCore.WindowSystem.compositingActive
-                                                    && kirigamiLibraryIsFound
 
     //!current shadow state but do not change other values of normal mode, for example if a Dock hides its screen edge thickness
     //!shouldnt change the fact that customShadowedRectangle is still used
@@ -189,7 +187,7 @@ BackgroundProperties{
     readonly property bool customDefShadowIsEnabled: customShadowIsSupported && !customUserShadowIsEnabled && customRadiusIsEnabled
     readonly property bool customUserShadowIsEnabled: customShadowIsSupported && plasmoid.configuration.backgroundShadowSize >= 0
 
-    readonly property bool customRadiusIsEnabled: kirigamiLibraryIsFound && plasmoid.configuration.backgroundRadius >= 0
+    readonly property bool customRadiusIsEnabled: plasmoid.configuration.backgroundRadius >= 0
 
     readonly property int customRadius: {
         if (customDefShadowIsEnabled && !customRadiusIsEnabled && themeExtendedBackground) {
@@ -291,10 +289,11 @@ BackgroundProperties{
     //! Layer 2: Provide visual solidness. Plasma themes by design may provide a panel-background svg that is not
     //!          solid. That means that user can not gain full solidness in such cases. This layer is responsible
     //!          to solve the previous mentioned plasma theme limitation.
-    Colorizer.CustomBackground {
+    LatteContainment.BackgroundRenderer {
         id: backgroundLowestRectangle
         anchors.fill: solidBackground
         opacity: normalizedOpacity
+        enabledBorders: overlayedBackground.enabledBorders
         backgroundColor: colorizerManager.backgroundColor
         roundness: overlayedBackground.roundness
         visible: LatteCore.WindowSystem.compositingActive && solidBackground.exceedsThemeOpacityLimits
@@ -317,7 +316,7 @@ BackgroundProperties{
     //!          the original background when to special settings and options exist from the user. It is also
     //!          doing one very important job which is to calculate the Effects Rectangle which is used from
     //!          the compositor to provide blurriness and from Mask calculations to provide the View Local Geometry
-    PlasmaCore.FrameSvgItem{
+    Item{
         id: solidBackground
         anchors.leftMargin: shadows.left
         anchors.rightMargin: shadows.right
@@ -325,9 +324,11 @@ BackgroundProperties{
         anchors.bottomMargin: shadows.bottom
         anchors.fill: shadowsSvgItem
 
-        imagePath: "widgets/panel-background"
         opacity: normalizedOpacity
 
+        property alias enabledBorders: themeBackground.enabledBorders
+        property alias margins: themeBackground.margins
+
         readonly property bool exceedsThemeOpacityLimits: appliedOpacity > themeMaxOpacity
         readonly property bool forceSolidness: root.forceSolidPanel || !LatteCore.WindowSystem.compositingActive
 
@@ -348,7 +349,6 @@ BackgroundProperties{
 
         onWidthChanged: updateEffectsArea();
         onHeightChanged: updateEffectsArea();
-        onImagePathChanged: solidBackground.adjustPrefix();
 
 
         Component.onCompleted: {
@@ -434,12 +434,25 @@ BackgroundProperties{
             onTriggered: solidBackground.invUpdateEffectsArea();
         }
 
-        onRepaintNeeded: {
-            if (root.behaveAsPlasmaPanel)
-                adjustPrefix();
-        }
+        PlasmaCore.FrameSvgItem{
+            id: themeBackground
+            //! the theme frame follows the background geometry only while it is painted, this way
+            //! it is not resized and repainted while the custom layers replace it. Its margins do
+            //! not depend on its size and are always valid
+            width: visible ? parent.width : 0
+            height: visible ? parent.height : 0
+            visible: solidBackground.opacity > 0
 
-        enabledBorders: latteView && latteView.effects ? latteView.effects.enabledBorders : PlasmaCore.FrameSvg.NoBorder
+            imagePath: "widgets/panel-background"
+            enabledBorders: latteView && latteView.effects ? latteView.effects.enabledBorders : PlasmaCore.FrameSvg.NoBorder
+
+            onImagePathChanged: solidBackground.adjustPrefix();
+
+            onRepaintNeeded: {
+                if (root.behaveAsPlasmaPanel)
+                    solidBackground.adjustPrefix();
+            }
+        }
 
         Behavior on opacity{
             enabled: LatteCore.WindowSystem.compositingActive && !solidBackground.paintInstantly
@@ -470,18 +483,21 @@ BackgroundProperties{
                 pre = "south";
                 break;
             default:
-                prefix = "";
+                themeBackground.prefix = "";
             }
 
-            prefix = [pre, ""];
+            themeBackground.prefix = [pre, ""];
         }
     }
 
-    //! Layer 4: Plasma theme design does not provide a way to colorize the background. This layer
-    //!          solves this by providing a custom background layer that respects the Colorizer palette
-    Colorizer.CustomBackground {
+    //! Layer 4: Plasma theme design does not provide a way to colorize the background and to draw
+    //!          background outline on demand. This layer solves both by providing a custom background
+    //!          layer that respects the Colorizer palette and draws its shadow and its outline on top of
+    //!          all previous layers
+    LatteContainment.BackgroundRenderer {
         id: overlayedBackground
         anchors.fill: solidBackground
+        enabledBorders: latteView && latteView.effects ? latteView.effects.enabledBorders : PlasmaCore.FrameSvg.NoBorder
 
         readonly property bool busyBackground: root.forcePanelForBusyBackground
                                                && (solidBackground.opacity === 0 || !solidBackground.paintInstantly)
@@ -500,9 +516,20 @@ BackgroundProperties{
         }
 
         backgroundColor: colorizerManager.backgroundColor
-        shadowColor: customShadowColor
+        //! WORKAROUND, plasma theme shadow color compared to the drawn shadow has an alpha difference. This way
+        //! we make sure that when the user uses the same shadow size with plasma theme original one we draw the same shadow visually
+        shadowColor: Qt.rgba(customShadowColor.r, customShadowColor.g, customShadowColor.b, Math.min(1, 0.336 + customShadowColor.a))
         shadowSize: customShadowIsEnabled ? customShadow : 0
 
+        outlineColor: colorizerManager.outlineColor
+        outlineWidth: {
+            if (!root.panelOutline || (root.hasExpandedApplet && root.plasmaBackgroundForPopups)) {
+                return 0;
+            }
+
+            return themeExtended ? themeExtended.outlineWidth : 1;
+        }
+
         roundness: {
             if (customRadiusIsEnabled) {
                 return customRadius;
@@ -544,26 +571,13 @@ BackgroundProperties{
         }
     }
 
-    //! Layer 5: Plasma theme design does not provide a way to draw background outline on demand. This layer
-    //!          solves this by providing a custom background layer that only draws an outline on top of all
-    //!          previous layers
-    Loader{
-        anchors.fill: solidBackground
-        active: root.panelOutline && !(root.hasExpandedApplet && root.plasmaBackgroundForPopups)
-        sourceComponent: Colorizer.CustomBackground{
-            backgroundColor: "transparent"
-            borderColor: colorizerManager.outlineColor
-            borderWidth: themeExtended ? themeExtended.outlineWidth : 1
-            roundness: overlayedBackground.roundness
-        }
-    }
-
-    //! CustomBackground debugger
-    /*Colorizer.CustomBackground {
+    //! BackgroundRenderer debugger
+    /*LatteContainment.BackgroundRenderer {
         anchors.fill: solidBackground
+        enabledBorders: overlayedBackground.enabledBorders
         backgroundColor: "transparent"
-        borderWidth: 1
-        borderColor: "red"
+        outlineWidth: 1
+        outlineColor: "red"
         roundness: overlayedBackground.roundness
     }*/
 
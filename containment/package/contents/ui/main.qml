@@ -61,7 +61,6 @@ Item {
 
     ////BEGIN properties
     readonly property int version: LatteCore.Environment.makeVersion(0,9,75)
-    readonly property bool kirigamiLibraryIsFound: LatteCore.Environment.frameworksVersion >= LatteCore.Environment.makeVersion(5,69,0)
 
     property bool backgroundOnlyOnMaximized: plasmoid.configuration.backgroundOnlyOnMaximized
     readonly property bool behaveAsPlasmaPanel: viewType === LatteCore.Types.PanelView
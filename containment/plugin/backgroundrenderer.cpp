@@ -0,0 +1,444 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "backgroundrenderer.h"
+
+// C++
+#include <cstring>
+
+// Qt
+#include <QSGClipNode>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <QtMath>
+
+namespace Latte {
+namespace Containment {
+
+namespace {
+//! shadows are drawn with a quadratic falloff that is approximated with these rings
+const int SHADOWSTEPS = 4;
+//! arcs are tessellated with about one segment every two pixels
+const int MINARCSEGMENTS = 3;
+const int MAXARCSEGMENTS = 16;
+}
+
+BackgroundRenderer::BackgroundRenderer(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+}
+
+BackgroundRenderer::~BackgroundRenderer()
+{
+}
+
+int BackgroundRenderer::enabledBorders() const
+{
+    return m_enabledBorders;
+}
+
+void BackgroundRenderer::setEnabledBorders(int borders)
+{
+    if (m_enabledBorders == borders) {
+        return;
+    }
+
+    m_enabledBorders = borders;
+    update();
+    emit enabledBordersChanged();
+}
+
+int BackgroundRenderer::roundness() const
+{
+    return m_roundness;
+}
+
+void BackgroundRenderer::setRoundness(int roundness)
+{
+    if (m_roundness == roundness) {
+        return;
+    }
+
+    m_roundness = roundness;
+    update();
+    emit roundnessChanged();
+}
+
+qreal BackgroundRenderer::backgroundOpacity() const
+{
+    return m_backgroundOpacity;
+}
+
+void BackgroundRenderer::setBackgroundOpacity(qreal opacity)
+{
+    if (m_backgroundOpacity == opacity) {
+        return;
+    }
+
+    m_backgroundOpacity = opacity;
+    update();
+    emit backgroundOpacityChanged();
+}
+
+QColor BackgroundRenderer::backgroundColor() const
+{
+    return m_backgroundColor;
+}
+
+void BackgroundRenderer::setBackgroundColor(const QColor &color)
+{
+    if (m_backgroundColor == color) {
+        return;
+    }
+
+    m_backgroundColor = color;
+    update();
+    emit backgroundColorChanged();
+}
+
+int BackgroundRenderer::outlineWidth() const
+{
+    return m_outlineWidth;
+}
+
+void BackgroundRenderer::setOutlineWidth(int width)
+{
+    if (m_outlineWidth == width) {
+        return;
+    }
+
+    m_outlineWidth = width;
+    update();
+    emit outlineWidthChanged();
+}
+
+QColor BackgroundRenderer::outlineColor() const
+{
+    return m_outlineColor;
+}
+
+void BackgroundRenderer::setOutlineColor(const QColor &color)
+{
+    if (m_outlineColor == color) {
+        return;
+    }
+
+    m_outlineColor = color;
+    update();
+    emit outlineColorChanged();
+}
+
+int BackgroundRenderer::shadowSize() const
+{
+    return m_shadowSize;
+}
+
+void BackgroundRenderer::setShadowSize(int size)
+{
+    if (m_shadowSize == size) {
+        return;
+    }
+
+    m_shadowSize = size;
+    update();
+    emit shadowSizeChanged();
+}
+
+QColor BackgroundRenderer::shadowColor() const
+{
+    return m_shadowColor;
+}
+
+void BackgroundRenderer::setShadowColor(const QColor &color)
+{
+    if (m_shadowColor == color) {
+        return;
+    }
+
+    m_shadowColor = color;
+    update();
+    emit shadowColorChanged();
+}
+
+bool BackgroundRenderer::hasBorder(const Border border) const
+{
+    return (m_enabledBorders & border) > 0;
+}
+
+bool BackgroundRenderer::isDrawn() const
+{
+    if (width() <= 0 || height() <= 0) {
+        return false;
+    }
+
+    const bool hasFill = m_backgroundOpacity > 0 && m_backgroundColor.alpha() > 0;
+    const bool hasOutline = m_outlineWidth > 0 && m_outlineColor.alpha() > 0;
+    const bool hasShadow = m_shadowSize > 0 && m_shadowColor.alpha() > 0;
+
+    return hasFill || hasOutline || hasShadow;
+}
+
+QRectF BackgroundRenderer::shapeRect() const
+{
+    //! disabled borders are moved far enough for their outline, shadow and corners to be clipped
+    const qreal exceed = qMax(0, m_roundness) + qMax(0, m_outlineWidth) + qMax(0, m_shadowSize) + 2;
+
+    return QRectF(0, 0, width(), height()).adjusted(hasBorder(LeftBorder) ? 0 : -exceed,
+                                                    hasBorder(TopBorder) ? 0 : -exceed,
+                                                    hasBorder(RightBorder) ? 0 : exceed,
+                                                    hasBorder(BottomBorder) ? 0 : exceed);
+}
+
+QRectF BackgroundRenderer::clipRect() const
+{
+    //! one more pixel for the antialiased edge
+    const qreal exceed = qMax(0, m_shadowSize) + 1;
+
+    return QRectF(0, 0, width(), height()).adjusted(hasBorder(LeftBorder) ? -exceed : 0,
+                                                    hasBorder(TopBorder) ? -exceed : 0,
+                                                    hasBorder(RightBorder) ? exceed : 0,
+                                                    hasBorder(BottomBorder) ? exceed : 0);
+}
+
+QPointF BackgroundRenderer::OutlinePoint::offsetted(const qreal d) const
+{
+    if (radius > 0) {
+        //! inner offsets of rounded corners collapse at their center
+        return center + direction * qMax(0.0, radius + d);
+    }
+
+    //! square corners move diagonally, direction is (+-1, +-1)
+    return center + direction * d;
+}
+
+QVector<BackgroundRenderer::OutlinePoint> BackgroundRenderer::outline() const
+{
+    const QRectF shape = shapeRect();
+    const qreal maxRadius = qMin(width(), height()) / 2;
+    const qreal radius = qBound(0.0, (qreal)m_roundness, maxRadius);
+
+    //! corners in clockwise order starting from top-left, with their arc start angle
+    struct Corner {
+        QPointF point;
+        QPointF direction;
+        bool rounded;
+        qreal startAngle;
+    };
+
+    const Corner corners[4] = {
+        {shape.topLeft(), QPointF(-1, -1), hasBorder(TopBorder) && hasBorder(LeftBorder), 180},
+        {shape.topRight(), QPointF(1, -1), hasBorder(TopBorder) && hasBorder(RightBorder), 270},
+        {shape.bottomRight(), QPointF(1, 1), hasBorder(BottomBorder) && hasBorder(RightBorder), 0},
+        {shape.bottomLeft(), QPointF(-1, 1), hasBorder(BottomBorder) && hasBorder(LeftBorder), 90}
+    };
+
+    const int segments = qBound(MINARCSEGMENTS, qCeil(radius / 2), MAXARCSEGMENTS);
+
+    QVector<OutlinePoint> points;
+    points.reserve(4 * (segments + 1));
+
+    for (const auto &corner : corners) {
+        if (!corner.rounded || radius <= 0) {
+            OutlinePoint point;
+            point.center = corner.point;
+            point.direction = corner.direction;
+            points << point;
+            continue;
+        }
+
+        //! the arc center is the corner moved inside by radius
+        const QPointF center = corner.point - corner.direction * radius;
+
+        for (int i = 0; i <= segments; ++i) {
+            const qreal angle = qDegreesToRadians(corner.startAngle + (90.0 * i) / segments);
+
+            OutlinePoint point;
+            point.center = center;
+            point.direction = QPointF(qCos(angle), qSin(angle));
+            point.radius = radius;
+            points << point;
+        }
+    }
+
+    return points;
+}
+
+BackgroundRenderer::Color BackgroundRenderer::premultiplied(const QColor &color, const qreal opacity)
+{
+    const qreal alpha = qBound(0.0, color.alphaF() * opacity, 1.0);
+
+    Color result;
+    result.r = static_cast<uchar>(qRound(color.redF() * alpha * 255));
+    result.g = static_cast<uchar>(qRound(color.greenF() * alpha * 255));
+    result.b = static_cast<uchar>(qRound(color.blueF() * alpha * 255));
+    result.a = static_cast<uchar>(qRound(alpha * 255));
+
+    return result;
+}
+
+void BackgroundRenderer::addVertex(Vertices &vertices, const QPointF &point, const Color &color)
+{
+    QSGGeometry::ColoredPoint2D vertex;
+    vertex.set(point.x(), point.y(), color.r, color.g, color.b, color.a);
+    vertices << vertex;
+}
+
+void BackgroundRenderer::addFill(Vertices &vertices, const QVector<OutlinePoint> &outline, const QPointF &center, const qreal d, const Color &color)
+{
+    //! the shape is convex so a fan from its center covers it
+    for (int i = 0; i < outline.count(); ++i) {
+        const OutlinePoint &current = outline[i];
+        const OutlinePoint &next = outline[(i + 1) % outline.count()];
+
+        addVertex(vertices, center, color);
+        addVertex(vertices, current.offsetted(d), color);
+        addVertex(vertices, next.offsetted(d), color);
+    }
+}
+
+void BackgroundRenderer::addRing(Vertices &vertices, const QVector<OutlinePoint> &outline,
+                                 const qreal d0, const Color &color0, const qreal d1, const Color &color1)
+{
+    for (int i = 0; i < outline.count(); ++i) {
+        const OutlinePoint &current = outline[i];
+        const OutlinePoint &next = outline[(i + 1) % outline.count()];
+
+        const QPointF a0 = current.offsetted(d0);
+        const QPointF b0 = next.offsetted(d0);
+        const QPointF a1 = current.offsetted(d1);
+        const QPointF b1 = next.offsetted(d1);
+
+        addVertex(vertices, a0, color0);
+        addVertex(vertices, b0, color0);
+        addVertex(vertices, b1, color1);
+
+        addVertex(vertices, a0, color0);
+        addVertex(vertices, b1, color1);
+        addVertex(vertices, a1, color1);
+    }
+}
+
+BackgroundRenderer::Vertices BackgroundRenderer::vertices() const
+{
+    //! layers are added bottom to top, triangles of one draw call are blended in order
+    const QVector<OutlinePoint> points = outline();
+    const QPointF center = shapeRect().center();
+    const Color transparent{};
+
+    Vertices result;
+
+    if (m_shadowSize > 0 && m_shadowColor.alpha() > 0) {
+        for (int i = 0; i < SHADOWSTEPS; ++i) {
+            const qreal t0 = (qreal)i / SHADOWSTEPS;
+            const qreal t1 = (qreal)(i + 1) / SHADOWSTEPS;
+
+            addRing(result, points,
+                    t0 * m_shadowSize, premultiplied(m_shadowColor, (1 - t0) * (1 - t0)),
+                    t1 * m_shadowSize, premultiplied(m_shadowColor, (1 - t1) * (1 - t1)));
+        }
+    }
+
+    //! edges are antialiased with one pixel wide rings that fade out
+    if (m_backgroundOpacity > 0 && m_backgroundColor.alpha() > 0) {
+        const Color fill = premultiplied(m_backgroundColor, m_backgroundOpacity);
+
+        addFill(result, points, center, -0.5, fill);
+        addRing(result, points, -0.5, fill, 0.5, transparent);
+    }
+
+    if (m_outlineWidth > 0 && m_outlineColor.alpha() > 0) {
+        const Color line = premultiplied(m_outlineColor, 1.0);
+        const qreal inner = -m_outlineWidth;
+
+        addRing(result, points, inner - 0.5, transparent, inner + 0.5, line);
+
+        if (m_outlineWidth > 1) {
+            addRing(result, points, inner + 0.5, line, -0.5, line);
+        }
+
+        addRing(result, points, -0.5, line, 0.5, transparent);
+    }
+
+    return result;
+}
+
+void BackgroundRenderer::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+
+    if (newGeometry.size() != oldGeometry.size()) {
+        update();
+    }
+}
+
+QSGNode *BackgroundRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    if (!isDrawn()) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    QSGClipNode *clipNode = static_cast<QSGClipNode *>(oldNode);
+    QSGGeometryNode *backgroundNode{nullptr};
+
+    if (!clipNode) {
+        clipNode = new QSGClipNode();
+        clipNode->setIsRectangular(true);
+        clipNode->setGeometry(new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 4));
+        clipNode->setFlag(QSGNode::OwnsGeometry);
+
+        QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+
+        backgroundNode = new QSGGeometryNode();
+        backgroundNode->setGeometry(geometry);
+        backgroundNode->setMaterial(new QSGVertexColorMaterial());
+        backgroundNode->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+
+        clipNode->appendChildNode(backgroundNode);
+    } else {
+        backgroundNode = static_cast<QSGGeometryNode *>(clipNode->firstChild());
+    }
+
+    const QRectF clip = clipRect();
+    clipNode->setClipRect(clip);
+    QSGGeometry::updateRectGeometry(clipNode->geometry(), clip);
+    clipNode->markDirty(QSGNode::DirtyGeometry);
+
+    const Vertices vertices = this->vertices();
+    QSGGeometry *geometry = backgroundNode->geometry();
+
+    if (geometry->vertexCount() != vertices.count()) {
+        geometry->allocate(vertices.count());
+    }
+
+    if (!vertices.isEmpty()) {
+        std::memcpy(geometry->vertexDataAsColoredPoint2D(), vertices.constData(), vertices.count() * sizeof(QSGGeometry::ColoredPoint2D));
+    }
+
+    backgroundNode->markDirty(QSGNode::DirtyGeometry);
+
+    return clipNode;
+}
+
+}
+}
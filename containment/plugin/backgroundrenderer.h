@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTECONTAINMENTBACKGROUNDRENDERER_H
+#define LATTECONTAINMENTBACKGROUNDRENDERER_H
+
+// Qt
+#include <QColor>
+#include <QPointF>
+#include <QQuickItem>
+#include <QSGGeometry>
+#include <QVector>
+
+namespace Latte {
+namespace Containment {
+
+//! Paints the custom layers of the view background, the colorized fill, its shadow
+//! and its outline, as a single vertex colored geometry. Corners are rounded only
+//! when both of their borders are enabled, the same rule that is used for the
+//! background mask, and disabled borders are drawn past the item and clipped away.
+//! The geometry is recomputed only when one of its inputs changes and no svg or
+//! texture is involved, so resizing it during animations stays cheap.
+class BackgroundRenderer : public QQuickItem
+{
+    Q_OBJECT
+    //! Plasma::FrameSvg::EnabledBorders flags
+    Q_PROPERTY(int enabledBorders READ enabledBorders WRITE setEnabledBorders NOTIFY enabledBordersChanged)
+    Q_PROPERTY(int roundness READ roundness WRITE setRoundness NOTIFY roundnessChanged)
+
+    //! backgroundOpacity is applied only to the fill, shadow and outline are drawn with their own colors
+    Q_PROPERTY(qreal backgroundOpacity READ backgroundOpacity WRITE setBackgroundOpacity NOTIFY backgroundOpacityChanged)
+    Q_PROPERTY(QColor backgroundColor READ backgroundColor WRITE setBackgroundColor NOTIFY backgroundColorChanged)
+
+    Q_PROPERTY(int outlineWidth READ outlineWidth WRITE setOutlineWidth NOTIFY outlineWidthChanged)
+    Q_PROPERTY(QColor outlineColor READ outlineColor WRITE setOutlineColor NOTIFY outlineColorChanged)
+
+    Q_PROPERTY(int shadowSize READ shadowSize WRITE setShadowSize NOTIFY shadowSizeChanged)
+    Q_PROPERTY(QColor shadowColor READ shadowColor WRITE setShadowColor NOTIFY shadowColorChanged)
+
+public:
+    BackgroundRenderer(QQuickItem *parent = nullptr);
+    ~BackgroundRenderer() override;
+
+    int enabledBorders() const;
+    void setEnabledBorders(int borders);
+
+    int roundness() const;
+    void setRoundness(int roundness);
+
+    qreal backgroundOpacity() const;
+    void setBackgroundOpacity(qreal opacity);
+
+    QColor backgroundColor() const;
+    void setBackgroundColor(const QColor &color);
+
+    int outlineWidth() const;
+    void setOutlineWidth(int width);
+
+    QColor outlineColor() const;
+    void setOutlineColor(const QColor &color);
+
+    int shadowSize() const;
+    void setShadowSize(int size);
+
+    QColor shadowColor() const;
+    void setShadowColor(const QColor &color);
+
+signals:
+    void backgroundColorChanged();
+    void backgroundOpacityChanged();
+    void enabledBordersChanged();
+    void outlineColorChanged();
+    void outlineWidthChanged();
+    void roundnessChanged();
+    void shadowColorChanged();
+    void shadowSizeChanged();
+
+protected:
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+
+private:
+    enum Border {
+        NoBorder = 0,
+        TopBorder = 1,
+        BottomBorder = 2,
+        LeftBorder = 4,
+        RightBorder = 8
+    };
+
+    //! a point of the background outline, offsetting it by d moves it
+    //! along its corner direction: center + direction * (radius + d)
+    struct OutlinePoint {
+        QPointF center;
+        QPointF direction;
+        qreal radius{0};
+
+        QPointF offsetted(const qreal d) const;
+    };
+
+    //! premultiplied color of vertices
+    struct Color {
+        uchar r{0};
+        uchar g{0};
+        uchar b{0};
+        uchar a{0};
+    };
+
+    typedef QVector<QSGGeometry::ColoredPoint2D> Vertices;
+
+    bool hasBorder(const Border border) const;
+    bool isDrawn() const;
+
+    //! shape of the background, it exceeds the item at disabled borders
+    QRectF shapeRect() const;
+    //! area the background is allowed to paint to, shadows included
+    QRectF clipRect() const;
+
+    QVector<OutlinePoint> outline() const;
+
+    Vertices vertices() const;
+
+    static void addFill(Vertices &vertices, const QVector<OutlinePoint> &outline, const QPointF &center, const qreal d, const Color &color);
+    static void addRing(Vertices &vertices, const QVector<OutlinePoint> &outline,
+                        const qreal d0, const Color &color0, const qreal d1, const Color &color1);
+    static void addVertex(Vertices &vertices, const QPointF &point, const Color &color);
+
+    static Color premultiplied(const QColor &color, const qreal opacity);
+
+private:
+    int m_enabledBorders{NoBorder};
+    int m_roundness{0};
+    int m_outlineWidth{0};
+    int m_shadowSize{0};
+
+    qreal m_backgroundOpacity{1.0};
+
+    QColor m_backgroundColor{Qt::black};
+    QColor m_outlineColor{Qt::transparent};
+    QColor m_shadowColor{Qt::black};
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,601 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "filllayouter.h"
+
+// C++
+#include <cmath>
+
+// Qt
+#include <QQuickItem>
+#include <QtMath>
+
+namespace Latte {
+namespace Containment {
+
+bool FillLayouter::AppletData::operator==(const AppletData &rhs) const
+{
+    return item == rhs.item
+            && layout == rhs.layout
+            && isAutoFill == rhs.isAutoFill
+            && isHidden == rhs.isHidden
+            && isValid == rhs.isValid
+            //! undefined metrics are considered equal
+            && (minimum == rhs.minimum || (std::isnan(minimum) && std::isnan(rhs.minimum)))
+            && (preferred == rhs.preferred || (std::isnan(preferred) && std::isnan(rhs.preferred)))
+            && (maximum == rhs.maximum || (std::isnan(maximum) && std::isnan(rhs.maximum)));
+}
+
+bool FillLayouter::AppletData::operator!=(const AppletData &rhs) const
+{
+    return !(*this == rhs);
+}
+
+bool FillLayouter::LayoutData::operator==(const LayoutData &rhs) const
+{
+    return fillApplets == rhs.fillApplets
+            && shownApplets == rhs.shownApplets
+            && sizeWithNoFillApplets == rhs.sizeWithNoFillApplets;
+}
+
+bool FillLayouter::LayoutData::operator!=(const LayoutData &rhs) const
+{
+    return !(*this == rhs);
+}
+
+bool FillLayouter::Inputs::operator==(const Inputs &rhs) const
+{
+    for (int i = 0; i < LayoutsCount; ++i) {
+        if (layouts[i] != rhs.layouts[i]) {
+            return false;
+        }
+    }
+
+    return justify == rhs.justify
+            && maxLength == rhs.maxLength
+            && minLength == rhs.minLength
+            && mainGridLength == rhs.mainGridLength
+            && applets == rhs.applets;
+}
+
+bool FillLayouter::Inputs::operator!=(const Inputs &rhs) const
+{
+    return !(*this == rhs);
+}
+
+FillLayouter::FillLayouter(QObject *parent)
+    : QObject(parent)
+{
+}
+
+FillLayouter::~FillLayouter()
+{
+}
+
+QObject *FillLayouter::startLayout() const
+{
+    return m_layouts[StartLayout];
+}
+
+void FillLayouter::setStartLayout(QObject *layout)
+{
+    if (m_layouts[StartLayout] == layout) {
+        return;
+    }
+
+    m_layouts[StartLayout] = layout;
+    emit startLayoutChanged();
+}
+
+QObject *FillLayouter::mainLayout() const
+{
+    return m_layouts[MainLayout];
+}
+
+void FillLayouter::setMainLayout(QObject *layout)
+{
+    if (m_layouts[MainLayout] == layout) {
+        return;
+    }
+
+    m_layouts[MainLayout] = layout;
+    emit mainLayoutChanged();
+}
+
+QObject *FillLayouter::endLayout() const
+{
+    return m_layouts[EndLayout];
+}
+
+void FillLayouter::setEndLayout(QObject *layout)
+{
+    if (m_layouts[EndLayout] == layout) {
+        return;
+    }
+
+    m_layouts[EndLayout] = layout;
+    emit endLayoutChanged();
+}
+
+bool FillLayouter::justify() const
+{
+    return m_justify;
+}
+
+void FillLayouter::setJustify(bool justify)
+{
+    if (m_justify == justify) {
+        return;
+    }
+
+    m_justify = justify;
+    emit justifyChanged();
+}
+
+int FillLayouter::maxLength() const
+{
+    return m_maxLength;
+}
+
+void FillLayouter::setMaxLength(int length)
+{
+    if (m_maxLength == length) {
+        return;
+    }
+
+    m_maxLength = length;
+    emit maxLengthChanged();
+}
+
+int FillLayouter::minLength() const
+{
+    return m_minLength;
+}
+
+void FillLayouter::setMinLength(int length)
+{
+    if (m_minLength == length) {
+        return;
+    }
+
+    m_minLength = length;
+    emit minLengthChanged();
+}
+
+QQuickItem *FillLayouter::grid(const int layout) const
+{
+    return m_layouts[layout] ? m_layouts[layout]->property("grid").value<QQuickItem *>() : nullptr;
+}
+
+FillLayouter::Inputs FillLayouter::currentInputs() const
+{
+    Inputs inputs;
+    inputs.justify = m_justify;
+    inputs.maxLength = m_maxLength;
+    inputs.minLength = m_minLength;
+
+    for (int layout = 0; layout < LayoutsCount; ++layout) {
+        QQuickItem *layoutGrid = grid(layout);
+
+        if (!layoutGrid) {
+            continue;
+        }
+
+        inputs.layouts[layout].fillApplets = m_layouts[layout]->property("fillApplets").toInt();
+        inputs.layouts[layout].shownApplets = m_layouts[layout]->property("shownApplets").toInt();
+        inputs.layouts[layout].sizeWithNoFillApplets = m_layouts[layout]->property("sizeWithNoFillApplets").toInt();
+
+        if (layout == MainLayout) {
+            inputs.mainGridLength = layoutGrid->property("length").toInt();
+        }
+
+        for (auto *item : layoutGrid->childItems()) {
+            AppletData applet;
+            applet.item = item;
+            applet.layout = layout;
+            applet.isAutoFill = item->property("isAutoFillApplet").toBool();
+            applet.isHidden = item->property("isHidden").toBool();
+            applet.isValid = item->property("applet").value<QObject *>() || item->property("isInternalViewSplitter").toBool();
+            applet.minimum = item->property("appletMinimumLength").toReal();
+            applet.preferred = item->property("appletPreferredLength").toReal();
+            applet.maximum = item->property("appletMaximumLength").toReal();
+
+            inputs.applets << applet;
+        }
+    }
+
+    return inputs;
+}
+
+int &FillLayouter::length(const int applet, const bool inMaxAutoFillCalculations)
+{
+    return inMaxAutoFillCalculations ? m_lengths[applet].maxLength : m_lengths[applet].minLength;
+}
+
+bool FillLayouter::isFillApplet(const int applet) const
+{
+    const AppletData &data = m_inputs.applets[applet];
+    return data.isAutoFill && !data.isHidden && data.isValid;
+}
+
+int FillLayouter::fillApplets() const
+{
+    return m_inputs.layouts[StartLayout].fillApplets
+            + m_inputs.layouts[MainLayout].fillApplets
+            + m_inputs.layouts[EndLayout].fillApplets;
+}
+
+qreal FillLayouter::appletPreferredLength(qreal min, qreal pref, qreal max)
+{
+    if (max == -1) {
+        max = pref == -1 ? min : pref;
+    }
+
+    if (pref == -1) {
+        pref = max == -1 ? min : pref;
+    }
+
+    return qMin(qMax(min, pref), max);
+}
+
+int FillLayouter::toLength(const qreal length)
+{
+    return std::isfinite(length) ? static_cast<int>(length) : 0;
+}
+
+void FillLayouter::updateLengths()
+{
+    Inputs inputs = currentInputs();
+
+    if (m_inputsAreValid && inputs == m_inputs) {
+        //! nothing changed, just make sure that applets still have their lengths
+        for (int layout = 0; layout < LayoutsCount; ++layout) {
+            writeLengths(layout);
+        }
+
+        return;
+    }
+
+    m_inputs = inputs;
+    m_inputsAreValid = true;
+
+    if (fillApplets() == 0) {
+        m_lengths.clear();
+        return;
+    }
+
+    //! applets continue from their current lengths
+    m_lengths.fill(AppletLengths(), m_inputs.applets.count());
+
+    for (int i = 0; i < m_inputs.applets.count(); ++i) {
+        m_lengths[i].maxLength = m_inputs.applets[i].item->property("maxAutoFillLength").toInt();
+        m_lengths[i].minLength = m_inputs.applets[i].item->property("minAutoFillLength").toInt();
+    }
+
+    const bool useMaximumLength = true;
+
+    if (m_inputs.layouts[MainLayout].shownApplets == 0 || !m_inputs.justify) {
+        updateFillAppletsWithOneStep(useMaximumLength);
+        updateFillAppletsWithOneStep(!useMaximumLength);
+    } else {
+        //! Justify mode in all remaining cases
+        updateFillAppletsWithTwoSteps(useMaximumLength);
+        updateFillAppletsWithTwoSteps(!useMaximumLength);
+    }
+
+    for (int layout = 0; layout < LayoutsCount; ++layout) {
+        writeLengths(layout);
+    }
+}
+
+void FillLayouter::writeLengths(const int layout)
+{
+    for (int i = 0; i < m_inputs.applets.count() && i < m_lengths.count(); ++i) {
+        const AppletData &applet = m_inputs.applets[i];
+
+        if (applet.layout != layout || !applet.isAutoFill) {
+            continue;
+        }
+
+        if (applet.item->property("maxAutoFillLength").toInt() != m_lengths[i].maxLength) {
+            applet.item->setProperty("maxAutoFillLength", m_lengths[i].maxLength);
+        }
+
+        if (applet.item->property("minAutoFillLength").toInt() != m_lengths[i].minLength) {
+            applet.item->setProperty("minAutoFillLength", m_lengths[i].minLength);
+        }
+    }
+}
+
+//! inform applets that new calculations are taking place
+void FillLayouter::initLayoutsForFillsCalculations()
+{
+    for (int i = 0; i < m_inputs.applets.count(); ++i) {
+        if (m_inputs.applets[i].isAutoFill) {
+            m_lengths[i].inFillCalculations = true;
+        }
+    }
+}
+
+//! during step1/pass1 all applets that provide valid metrics (minimum/preferred/maximum values)
+//! they gain a valid space in order to draw themeselves
+FillLayouter::StepResult FillLayouter::computeStep1ForLayout(const int layout, qreal availableSpace, qreal sizePerApplet, int noOfApplets, const bool inMaxAutoFillCalculations)
+{
+    for (int i = 0; i < m_inputs.applets.count(); ++i) {
+        const AppletData &applet = m_inputs.applets[i];
+
+        if (applet.layout != layout || !isFillApplet(i)) {
+            continue;
+        }
+
+        const qreal minSize = applet.minimum >= 0 && !qIsInf(applet.minimum) ? applet.minimum : -1;
+        const qreal prefSize = minSize >= 0 && !qIsInf(applet.preferred) ? applet.preferred : -1;
+        const qreal maxSize = applet.maximum >= 0 && !qIsInf(applet.maximum) ? applet.maximum : -1;
+
+        qreal appliedSize = -1;
+
+        //! applets that do not provide any valid metrics are given their space
+        //! from the system after the applets that provide nice metrics are assigned their sizes
+        const bool staticSize = (minSize >= 0 && maxSize == minSize);
+        const bool systemDecide = (prefSize < 0 && !staticSize);
+
+        if (systemDecide) {
+            continue;
+        }
+
+        if (noOfApplets > 1) {
+            appliedSize = appletPreferredLength(minSize, prefSize, maxSize);
+        } else if (noOfApplets == 1) {
+            //! at this step if only one applet has remained for which the max size is not null,
+            //! then for this applet we make sure the maximum size does not exceed the available space
+            //! in order for the applet to not be drawn outside the boundaries
+            appliedSize = appletPreferredLength(minSize, prefSize, qMin(maxSize, sizePerApplet));
+        }
+
+        //! appliedSize is valid and is also lower than the availableSpace, if it is not lower then
+        //! for this applet the needed space will be provided as a second pass in a fair way
+        //! between all remained applets that did not gain a valid fill space
+        if (appliedSize >= 0 && appliedSize <= sizePerApplet) {
+            length(i, inMaxAutoFillCalculations) = toLength(qMin(appliedSize, availableSpace));
+            m_lengths[i].inFillCalculations = false;
+
+            availableSpace = qMax<qreal>(0, availableSpace - m_lengths[i].maxLength);
+            noOfApplets = noOfApplets - 1;
+            sizePerApplet = noOfApplets > 1 ? qFloor(availableSpace / noOfApplets) : availableSpace;
+        }
+    }
+
+    StepResult result;
+    result.availableSpace = availableSpace;
+    result.sizePerApplet = sizePerApplet;
+    result.noOfApplets = noOfApplets;
+
+    return result;
+}
+
+//! during step2/pass2 all the applets with fills
+//! that remained with no computations from pass1
+//! are updated with the algorithm's proposed size
+void FillLayouter::computeStep2ForLayout(const int layout, const qreal sizePerApplet, const int noOfApplets, const bool inMaxAutoFillCalculations)
+{
+    if (sizePerApplet < 0) {
+        return;
+    }
+
+    if (noOfApplets != 0) {
+        for (int i = 0; i < m_inputs.applets.count(); ++i) {
+            const AppletData &applet = m_inputs.applets[i];
+
+            if (applet.layout == layout && applet.isAutoFill && !applet.isHidden && m_lengths[i].inFillCalculations) {
+                length(i, inMaxAutoFillCalculations) = toLength(qMax(applet.minimum, sizePerApplet));
+                m_lengths[i].inFillCalculations = false;
+            }
+        }
+
+        return;
+    }
+
+    //! when all applets have assigned some size and there is still free space, we must find
+    //! the most demanding space applet and assign the remaining space to it
+    int mostDemandingAppletSize = 0;
+    int mostDemandingApplet = -1;
+
+    //! applets with no strong opinion
+    QVector<int> neutralApplets;
+
+    for (int i = 0; i < m_inputs.applets.count(); ++i) {
+        const AppletData &applet = m_inputs.applets[i];
+
+        if (applet.layout != layout || !isFillApplet(i)) {
+            continue;
+        }
+
+        const bool isNeutral = (applet.minimum <= 0 && applet.preferred <= 0);
+
+        //! the most demanding applet is the one that has maximum size set to Infinity
+        //! AND is not Neutral, meaning that it provided some valid metrics
+        //! AND at the same time gained from step one the biggest space
+        if (!isNeutral && qIsInf(applet.maximum) && length(i, inMaxAutoFillCalculations) > mostDemandingAppletSize) {
+            mostDemandingApplet = i;
+            mostDemandingAppletSize = length(i, inMaxAutoFillCalculations);
+        } else if (isNeutral) {
+            neutralApplets << i;
+        }
+    }
+
+    if (mostDemandingApplet >= 0) {
+        //! the most demanding applet gains all the remaining space
+        int &appletLength = length(mostDemandingApplet, inMaxAutoFillCalculations);
+        appletLength = toLength(appletLength + sizePerApplet);
+    } else if (!neutralApplets.isEmpty()) {
+        //! if no demanding applets was found then the available space is splitted equally
+        //! between all neutralApplets
+        const qreal adjustedAppletSize = sizePerApplet / neutralApplets.count();
+
+        for (const int applet : neutralApplets) {
+            int &appletLength = length(applet, inMaxAutoFillCalculations);
+            appletLength = toLength(appletLength + adjustedAppletSize);
+        }
+    }
+}
+
+void FillLayouter::updateFillAppletsWithOneStep(const bool inMaxAutoFillCalculations)
+{
+    const int maxLength = inMaxAutoFillCalculations ? m_inputs.maxLength : m_inputs.minLength;
+    const LayoutData *layouts = m_inputs.layouts;
+
+    const qreal availableSpace = qMax(0, maxLength
+                                      - layouts[StartLayout].sizeWithNoFillApplets
+                                      - layouts[MainLayout].sizeWithNoFillApplets
+                                      - layouts[EndLayout].sizeWithNoFillApplets);
+    const int noA = fillApplets();
+
+    initLayoutsForFillsCalculations();
+
+    //! first pass in order to update sizes for applet that want to fill space
+    //! but their maximum metrics are lower than the sizePerApplet
+    StepResult res = computeStep1ForLayout(MainLayout, availableSpace, availableSpace / noA, noA, inMaxAutoFillCalculations);
+
+    if (m_inputs.justify) {
+        res = computeStep1ForLayout(StartLayout, res.availableSpace, res.sizePerApplet, res.noOfApplets, inMaxAutoFillCalculations);
+        res = computeStep1ForLayout(EndLayout, res.availableSpace, res.sizePerApplet, res.noOfApplets, inMaxAutoFillCalculations);
+    }
+
+    //! after step1 there is a chance that all applets were assigned a valid space
+    //! but at the same time some space remained free. In such case we make sure
+    //! that remained space will be assigned to the most demanding applet.
+    //! This is achieved by <layout>No values. For step2 passing value!=0
+    //! means default step2 behavior BUT value=0 means that remained space
+    //! must be also assigned at the end.
+    const bool remainedSpace = (res.noOfApplets == 0 && res.sizePerApplet > 0);
+
+    int startNo = -1;
+    int mainNo = -1;
+    int endNo = -1;
+
+    if (remainedSpace) {
+        if (layouts[StartLayout].fillApplets > 0) {
+            startNo = 0;
+        } else if (layouts[EndLayout].fillApplets > 0) {
+            endNo = 0;
+        } else if (layouts[MainLayout].fillApplets > 0) {
+            mainNo = 0;
+        }
+    }
+
+    //! second pass in order to update sizes for applet that want to fill space
+    //! these applets get the direct division of the available free space that
+    //! remained from step1 OR the the free available space that no applet requested yet
+    computeStep2ForLayout(StartLayout, res.sizePerApplet, startNo, inMaxAutoFillCalculations);
+    computeStep2ForLayout(MainLayout, res.sizePerApplet, mainNo, inMaxAutoFillCalculations);
+    computeStep2ForLayout(EndLayout, res.sizePerApplet, endNo, inMaxAutoFillCalculations);
+}
+
+void FillLayouter::updateFillAppletsWithTwoSteps(const bool inMaxAutoFillCalculations)
+{
+    const qreal maxLength = inMaxAutoFillCalculations ? m_inputs.maxLength : m_inputs.minLength;
+    const LayoutData &start = m_inputs.layouts[StartLayout];
+    const LayoutData &main = m_inputs.layouts[MainLayout];
+    const LayoutData &end = m_inputs.layouts[EndLayout];
+
+    //! compute the two free spaces around the centered layout
+    //! they are called start and end accordingly
+    const qreal halfMainLayout = main.sizeWithNoFillApplets / 2.0;
+    qreal availableSpaceStart = qMax<qreal>(0, maxLength / 2 - start.sizeWithNoFillApplets - halfMainLayout);
+    qreal availableSpaceEnd = qMax<qreal>(0, maxLength / 2 - end.sizeWithNoFillApplets - halfMainLayout);
+    qreal availableSpace;
+
+    if (main.fillApplets == 0 || (start.shownApplets == 0 && end.shownApplets == 0)) {
+        //! no fill applets in main OR we are in alignment that all applets are in main
+        availableSpace = availableSpaceStart + availableSpaceEnd - main.sizeWithNoFillApplets;
+    } else {
+        //! use the minimum available space in order to avoid overlaps
+        availableSpace = 2 * qMin(availableSpaceStart, availableSpaceEnd) - main.sizeWithNoFillApplets;
+    }
+
+    qreal sizePerAppletMain = main.fillApplets > 0 ? availableSpace / fillApplets() : 0;
+
+    int noStart = start.fillApplets;
+    int noMain = main.fillApplets;
+    int noEnd = end.fillApplets;
+
+    initLayoutsForFillsCalculations();
+
+    //! first pass
+    if (main.fillApplets > 0) {
+        const StepResult res = computeStep1ForLayout(MainLayout, availableSpace, sizePerAppletMain, noMain, inMaxAutoFillCalculations);
+        sizePerAppletMain = res.sizePerApplet;
+        noMain = res.noOfApplets;
+
+        const qreal dif = (availableSpace - res.availableSpace) / 2;
+        availableSpaceStart = availableSpaceStart - dif;
+        availableSpaceEnd = availableSpaceEnd - dif;
+    }
+
+    qreal sizePerAppletStart = start.fillApplets > 0 ? availableSpaceStart / noStart : 0;
+    qreal sizePerAppletEnd = end.fillApplets > 0 ? availableSpaceEnd / noEnd : 0;
+
+    if (start.fillApplets > 0) {
+        const StepResult res = computeStep1ForLayout(StartLayout, availableSpaceStart, sizePerAppletStart, noStart, inMaxAutoFillCalculations);
+        availableSpaceStart = res.availableSpace;
+        sizePerAppletStart = res.sizePerApplet;
+        noStart = res.noOfApplets;
+    }
+
+    if (end.fillApplets > 0) {
+        const StepResult res = computeStep1ForLayout(EndLayout, availableSpaceEnd, sizePerAppletEnd, noEnd, inMaxAutoFillCalculations);
+        availableSpaceEnd = res.availableSpace;
+        sizePerAppletEnd = res.sizePerApplet;
+        noEnd = res.noOfApplets;
+    }
+
+    //! second pass
+    if (main.fillApplets > 0) {
+        computeStep2ForLayout(MainLayout, sizePerAppletMain, noMain, inMaxAutoFillCalculations); //default behavior
+
+        if (start.fillApplets > 0 || end.fillApplets > 0) {
+            //! start and end fill applets are adjusted to the main layout final length,
+            //! so main layout applets must be resized first
+            writeLengths(MainLayout);
+        }
+    }
+
+    const qreal mainGridLength = (main.fillApplets > 0 && grid(MainLayout)) ? grid(MainLayout)->property("length").toReal() : 0;
+
+    if (start.fillApplets > 0) {
+        if (main.fillApplets > 0) {
+            //! adjust final fill applet size in mainlayouts final length
+            sizePerAppletStart = ((maxLength / 2) - (mainGridLength / 2) - start.sizeWithNoFillApplets) / noStart;
+        }
+
+        computeStep2ForLayout(StartLayout, sizePerAppletStart, noStart, inMaxAutoFillCalculations);
+    }
+
+    if (end.fillApplets > 0) {
+        if (main.fillApplets > 0) {
+            //! adjust final fill applet size in mainlayouts final length
+            sizePerAppletEnd = ((maxLength / 2) - (mainGridLength / 2) - end.sizeWithNoFillApplets) / noEnd;
+        }
+
+        computeStep2ForLayout(EndLayout, sizePerAppletEnd, noEnd, inMaxAutoFillCalculations);
+    }
+}
+
+}
+}
@@ -0,0 +1,183 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTECONTAINMENTFILLLAYOUTER_H
+#define LATTECONTAINMENTFILLLAYOUTER_H
+
+// Qt
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+
+class QQuickItem;
+
+namespace Latte {
+namespace Containment {
+
+//! Computes the minimum and maximum lengths of the applets that are requesting
+//! fillWidth/fillHeight for all three layouts (start/main/end) in one pass.
+//! Applets metrics are gathered first and when they are identical to the ones
+//! of the previous computation nothing is recomputed. Only the lengths that
+//! actually changed are written back to the applets.
+class FillLayouter : public QObject
+{
+    Q_OBJECT
+    //! layouter applets containers, they provide the grid of applets and
+    //! their fillApplets, shownApplets and sizeWithNoFillApplets counters
+    Q_PROPERTY(QObject *startLayout READ startLayout WRITE setStartLayout NOTIFY startLayoutChanged)
+    Q_PROPERTY(QObject *mainLayout READ mainLayout WRITE setMainLayout NOTIFY mainLayoutChanged)
+    Q_PROPERTY(QObject *endLayout READ endLayout WRITE setEndLayout NOTIFY endLayoutChanged)
+
+    Q_PROPERTY(bool justify READ justify WRITE setJustify NOTIFY justifyChanged)
+
+    //! available length for maximum and minimum fill lengths calculations
+    Q_PROPERTY(int maxLength READ maxLength WRITE setMaxLength NOTIFY maxLengthChanged)
+    Q_PROPERTY(int minLength READ minLength WRITE setMinLength NOTIFY minLengthChanged)
+
+public:
+    FillLayouter(QObject *parent = nullptr);
+    ~FillLayouter() override;
+
+    QObject *startLayout() const;
+    void setStartLayout(QObject *layout);
+
+    QObject *mainLayout() const;
+    void setMainLayout(QObject *layout);
+
+    QObject *endLayout() const;
+    void setEndLayout(QObject *layout);
+
+    bool justify() const;
+    void setJustify(bool justify);
+
+    int maxLength() const;
+    void setMaxLength(int length);
+
+    int minLength() const;
+    void setMinLength(int length);
+
+    Q_INVOKABLE void updateLengths();
+
+signals:
+    void endLayoutChanged();
+    void justifyChanged();
+    void mainLayoutChanged();
+    void maxLengthChanged();
+    void minLengthChanged();
+    void startLayoutChanged();
+
+private:
+    enum LayoutPosition {
+        StartLayout = 0,
+        MainLayout,
+        EndLayout,
+        LayoutsCount
+    };
+
+    struct AppletData {
+        QObject *item{nullptr};
+        int layout{MainLayout};
+
+        bool isAutoFill{false};
+        bool isHidden{false};
+        //! it is an applet or an internal view splitter
+        bool isValid{false};
+
+        qreal minimum{-1};
+        qreal preferred{-1};
+        qreal maximum{-1};
+
+        bool operator==(const AppletData &rhs) const;
+        bool operator!=(const AppletData &rhs) const;
+    };
+
+    struct LayoutData {
+        int fillApplets{0};
+        int shownApplets{0};
+        int sizeWithNoFillApplets{0};
+
+        bool operator==(const LayoutData &rhs) const;
+        bool operator!=(const LayoutData &rhs) const;
+    };
+
+    struct Inputs {
+        bool justify{false};
+        int maxLength{0};
+        int minLength{0};
+        int mainGridLength{0};
+
+        LayoutData layouts[LayoutsCount];
+        QVector<AppletData> applets;
+
+        bool operator==(const Inputs &rhs) const;
+        bool operator!=(const Inputs &rhs) const;
+    };
+
+    //! working state of each applet during computations
+    struct AppletLengths {
+        int maxLength{-1};
+        int minLength{-1};
+        bool inFillCalculations{false};
+    };
+
+    struct StepResult {
+        qreal availableSpace{0};
+        qreal sizePerApplet{0};
+        int noOfApplets{0};
+    };
+
+    Inputs currentInputs() const;
+    QQuickItem *grid(const int layout) const;
+
+    int &length(const int applet, const bool inMaxAutoFillCalculations);
+    bool isFillApplet(const int applet) const;
+    int fillApplets() const;
+
+    void initLayoutsForFillsCalculations();
+    void writeLengths(const int layout);
+
+    StepResult computeStep1ForLayout(const int layout, qreal availableSpace, qreal sizePerApplet, int noOfApplets, const bool inMaxAutoFillCalculations);
+    void computeStep2ForLayout(const int layout, const qreal sizePerApplet, const int noOfApplets, const bool inMaxAutoFillCalculations);
+
+    void updateFillAppletsWithOneStep(const bool inMaxAutoFillCalculations);
+    void updateFillAppletsWithTwoSteps(const bool inMaxAutoFillCalculations);
+
+    //! qBound style function that is specialized in Layouts
+    //! meaning that -1 values are ignored for fillWidth(s)/Height(s)
+    static qreal appletPreferredLength(qreal min, qreal pref, qreal max);
+    //! lengths are stored in integer properties
+    static int toLength(const qreal length);
+
+private:
+    bool m_justify{false};
+    int m_maxLength{0};
+    int m_minLength{0};
+
+    QPointer<QObject> m_layouts[LayoutsCount];
+
+    Inputs m_inputs;
+    bool m_inputsAreValid{false};
+
+    QVector<AppletLengths> m_lengths;
+};
+
+}
+}
+
+#endif
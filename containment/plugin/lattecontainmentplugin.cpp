@@ -20,7 +20,10 @@
 #include "lattecontainmentplugin.h"
 
 // local
+#include "backgroundrenderer.h"
+#include "filllayouter.h"
 #include "types.h"
+#include "visibleindexer.h"
 
 // Qt
 #include <QtQml>
@@ -29,5 +32,8 @@ void LatteContainmentPlugin::registerTypes(const char *uri)
 {
     Q_ASSERT(uri == QLatin1String("org.kde.latte.private.containment"));
     qmlRegisterUncreatableType<Latte::Containment::Types>(uri, 0, 1, "Types", "Latte Containment Types uncreatable");
+    qmlRegisterType<Latte::Containment::BackgroundRenderer>(uri, 0, 1, "BackgroundRenderer");
+    qmlRegisterType<Latte::Containment::FillLayouter>(uri, 0, 1, "FillLayouter");
+    qmlRegisterType<Latte::Containment::VisibleIndexer>(uri, 0, 1, "VisibleIndexer");
 }
 
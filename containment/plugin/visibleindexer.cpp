@@ -0,0 +1,211 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "visibleindexer.h"
+
+// C++
+#include <algorithm>
+
+namespace Latte {
+namespace Containment {
+
+VisibleIndexer::VisibleIndexer(QObject *parent)
+    : QObject(parent)
+{
+}
+
+VisibleIndexer::~VisibleIndexer()
+{
+}
+
+QList<int> VisibleIndexer::applets() const
+{
+    return m_applets;
+}
+
+void VisibleIndexer::setApplets(const QList<int> &applets)
+{
+    if (m_applets == applets) {
+        return;
+    }
+
+    m_applets = applets;
+    m_appletsBits = indexesToBits(applets);
+    updateVisibleIndexes();
+
+    emit appletsChanged();
+}
+
+QList<int> VisibleIndexer::separators() const
+{
+    return m_separators;
+}
+
+void VisibleIndexer::setSeparators(const QList<int> &separators)
+{
+    if (m_separators == separators) {
+        return;
+    }
+
+    m_separators = separators;
+    m_separatorsBits = indexesToBits(separators);
+    updateVisibleIndexes();
+
+    emit separatorsChanged();
+}
+
+QList<int> VisibleIndexer::hidden() const
+{
+    return m_hidden;
+}
+
+void VisibleIndexer::setHidden(const QList<int> &hidden)
+{
+    if (m_hidden == hidden) {
+        return;
+    }
+
+    m_hidden = hidden;
+    m_hiddenBits = indexesToBits(hidden);
+    updateVisibleIndexes();
+
+    emit hiddenChanged();
+}
+
+QVariantMap VisibleIndexer::clientsItemsCounts() const
+{
+    return m_clientsItemsCounts;
+}
+
+void VisibleIndexer::setClientsItemsCounts(const QVariantMap &counts)
+{
+    if (m_clientsItemsCounts == counts) {
+        return;
+    }
+
+    m_clientsItemsCounts = counts;
+    updateVisibleIndexes();
+
+    emit clientsItemsCountsChanged();
+}
+
+int VisibleIndexer::visibleItemsCount() const
+{
+    return m_itemsBefore.last();
+}
+
+QBitArray VisibleIndexer::indexesToBits(const QList<int> &indexes)
+{
+    int size{0};
+
+    for (const auto index : indexes) {
+        size = qMax(size, index + 1);
+    }
+
+    QBitArray bits(size);
+
+    for (const auto index : indexes) {
+        if (index >= 0) {
+            bits.setBit(index);
+        }
+    }
+
+    return bits;
+}
+
+void VisibleIndexer::updateVisibleIndexes()
+{
+    const int size = m_appletsBits.size();
+
+    QVector<int> itemsCount(size, 0);
+
+    for (int i = 0; i < size; ++i) {
+        if (!m_appletsBits.testBit(i)
+                || (i < m_separatorsBits.size() && m_separatorsBits.testBit(i))
+                || (i < m_hiddenBits.size() && m_hiddenBits.testBit(i))) {
+            continue;
+        }
+
+        itemsCount[i] = 1;
+    }
+
+    for (auto it = m_clientsItemsCounts.constBegin(); it != m_clientsItemsCounts.constEnd(); ++it) {
+        const int index = it.key().toInt();
+
+        if (index >= 0 && index < size && itemsCount[index] > 0) {
+            itemsCount[index] = qMax(0, it.value().toInt());
+        }
+    }
+
+    //! only the prefix sums after the first changed applet need to be updated
+    int firstChanged{0};
+    const int commonSize = qMin(size, m_itemsCount.size());
+
+    while (firstChanged < commonSize && itemsCount[firstChanged] == m_itemsCount[firstChanged]) {
+        ++firstChanged;
+    }
+
+    if (firstChanged == size && size == m_itemsCount.size()) {
+        return;
+    }
+
+    m_itemsCount = itemsCount;
+    m_itemsBefore.resize(size + 1);
+
+    for (int i = firstChanged; i < size; ++i) {
+        m_itemsBefore[i + 1] = m_itemsBefore[i] + m_itemsCount[i];
+    }
+
+    emit visibleIndexesChanged();
+}
+
+int VisibleIndexer::visibleItemsBeforeCount(const int appletIndex) const
+{
+    if (appletIndex <= 0) {
+        return 0;
+    }
+
+    return m_itemsBefore[qMin(appletIndex, m_itemsCount.size())];
+}
+
+int VisibleIndexer::visibleIndex(const int appletIndex) const
+{
+    if (appletIndex < 0
+            || (appletIndex < m_separatorsBits.size() && m_separatorsBits.testBit(appletIndex))
+            || (appletIndex < m_hiddenBits.size() && m_hiddenBits.testBit(appletIndex))) {
+        return -1;
+    }
+
+    return visibleItemsBeforeCount(appletIndex) + 1;
+}
+
+int VisibleIndexer::appletIndexForVisibleIndex(const int visibleIndex) const
+{
+    if (visibleIndex <= 0 || visibleIndex > visibleItemsCount()) {
+        return -1;
+    }
+
+    //! first applet whose visible items reach the requested visible index
+    const auto it = std::lower_bound(m_itemsBefore.constBegin() + 1, m_itemsBefore.constEnd(), visibleIndex);
+
+    return static_cast<int>(it - m_itemsBefore.constBegin()) - 1;
+}
+
+}
+}
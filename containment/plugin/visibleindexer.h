@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTECONTAINMENTVISIBLEINDEXER_H
+#define LATTECONTAINMENTVISIBLEINDEXER_H
+
+// Qt
+#include <QBitArray>
+#include <QList>
+#include <QObject>
+#include <QVariantMap>
+#include <QVector>
+
+namespace Latte {
+namespace Containment {
+
+//! Keeps the visible items prefix sums of the containment applets, in applets
+//! index order, so that visible index queries are answered in constant time.
+//! Separators and hidden applets are not counted, applets that support the
+//! indexer ability (e.g. latte tasks) count as many items as they report.
+class VisibleIndexer : public QObject
+{
+    Q_OBJECT
+    //! indexes of all applets, separators and hidden applets included
+    Q_PROPERTY(QList<int> applets READ applets WRITE setApplets NOTIFY appletsChanged)
+    Q_PROPERTY(QList<int> separators READ separators WRITE setSeparators NOTIFY separatorsChanged)
+    Q_PROPERTY(QList<int> hidden READ hidden WRITE setHidden NOTIFY hiddenChanged)
+
+    //! applet index to visible items count of applets that support the indexer ability
+    Q_PROPERTY(QVariantMap clientsItemsCounts READ clientsItemsCounts WRITE setClientsItemsCounts NOTIFY clientsItemsCountsChanged)
+
+    Q_PROPERTY(int visibleItemsCount READ visibleItemsCount NOTIFY visibleIndexesChanged)
+
+public:
+    VisibleIndexer(QObject *parent = nullptr);
+    ~VisibleIndexer() override;
+
+    QList<int> applets() const;
+    void setApplets(const QList<int> &applets);
+
+    QList<int> separators() const;
+    void setSeparators(const QList<int> &separators);
+
+    QList<int> hidden() const;
+    void setHidden(const QList<int> &hidden);
+
+    QVariantMap clientsItemsCounts() const;
+    void setClientsItemsCounts(const QVariantMap &counts);
+
+    int visibleItemsCount() const;
+
+    Q_INVOKABLE int visibleIndex(const int appletIndex) const;
+    Q_INVOKABLE int visibleItemsBeforeCount(const int appletIndex) const;
+    Q_INVOKABLE int appletIndexForVisibleIndex(const int visibleIndex) const;
+
+signals:
+    void appletsChanged();
+    void clientsItemsCountsChanged();
+    void hiddenChanged();
+    void separatorsChanged();
+    void visibleIndexesChanged();
+
+private:
+    void updateVisibleIndexes();
+
+    static QBitArray indexesToBits(const QList<int> &indexes);
+
+private:
+    QList<int> m_applets;
+    QList<int> m_separators;
+    QList<int> m_hidden;
+    QVariantMap m_clientsItemsCounts;
+
+    QBitArray m_appletsBits;
+    QBitArray m_separatorsBits;
+    QBitArray m_hiddenBits;
+
+    //! visible items of each applet index
+    QVector<int> m_itemsCount;
+    //! visible items of all applets with lower index, it has one more
+    //! entry at the end that holds all visible items
+    QVector<int> m_itemsBefore{0};
+};
+
+}
+}
+
+#endif
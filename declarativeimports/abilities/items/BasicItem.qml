@@ -94,6 +94,9 @@ Item{
     property bool isHiddenSpacerForcedShow: false
 
     property bool isHidden: false
+    //! the item is outside the visible area of a scrolling list and it is not needed
+    //! to load its heavy contents such as indicators
+    property bool isVirtualized: false
     property bool isSeparator: false
     property bool isSeparatorInRealLength: false
 
@@ -37,7 +37,7 @@ AbilityItem.IndicatorLevel {
     width: abilityItem.isHorizontal ? length : thickness
     height: abilityItem.isHorizontal ? thickness : length
 
-    level.isDrawn: level.indicator && level.indicator.host && level.indicator.host.isEnabled && !abilityItem.isSeparator && !abilityItem.isHidden
+    level.isDrawn: level.indicator && level.indicator.host && level.indicator.host.isEnabled && !abilityItem.isSeparator && !abilityItem.isHidden && !abilityItem.isVirtualized
 
     readonly property real length: abilityItem.parabolicItem.length - 2*abilityItem.parabolicItem.zoom*abilityItem.abilities.metrics.margin.length
     readonly property real thickness: abilityItem.parabolicItem.thickness
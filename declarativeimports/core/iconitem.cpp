@@ -26,12 +26,16 @@
 #include "extras.h"
 
 // Qt
+#include <QCache>
 #include <QDebug>
 #include <QPainter>
 #include <QPaintEngine>
+#include <QPainterPath>
 #include <QQuickWindow>
 #include <QPixmap>
+#include <QPointer>
 #include <QSGSimpleTextureNode>
+#include <QtMath>
 #include <QuickAddons/ManagedTextureNode>
 
 // KDE
@@ -41,6 +45,196 @@
 
 namespace Latte {
 
+namespace {
+//! shadowed icons are rendered in size steps, this way the parabolic zoom
+//! can reuse the same raster for all the frames of a step
+const int SHADOWSIZESTEP = 4;
+
+//! baked shadowed icon together with the icon it was baked from
+struct ShadowedIconData {
+    QPixmap icon;
+    QImage shadowed;
+};
+
+//! baked shadowed icons shared between all icon items, cost is measured in KBs.
+//! The cache is owned by the application, this way its pixmaps are released
+//! while the gui application still exists
+class ShadowedIconsCache : public QObject
+{
+public:
+    explicit ShadowedIconsCache(QObject *parent)
+        : QObject(parent),
+          icons(16 * 1024)
+    {
+    }
+
+    QCache<QString, ShadowedIconData> icons;
+};
+
+QCache<QString, ShadowedIconData> &shadowedIcons()
+{
+    static QPointer<ShadowedIconsCache> s_cache;
+
+    if (!s_cache) {
+        s_cache = new ShadowedIconsCache(qApp);
+    }
+
+    return s_cache->icons;
+}
+
+//! removes the shadowed icons of a source, for all sizes and shadows
+void removeShadowedIcons(const QString &source)
+{
+    if (source.isEmpty()) {
+        return;
+    }
+
+    QCache<QString, ShadowedIconData> &cache = shadowedIcons();
+    const QString prefix = source + QLatin1Char('|');
+
+    for (const auto &id : cache.keys()) {
+        if (id.startsWith(prefix)) {
+            cache.remove(id);
+        }
+    }
+}
+
+//! running sum box blur of an alpha channel, pixels outside the image are
+//! considered transparent in the same way a DropShadow without a transparent
+//! border treats them
+void boxBlur(QVector<int> &alpha, const int width, const int height, const int radius)
+{
+    const int span = 2 * radius + 1;
+    QVector<int> line(qMax(width, height));
+
+    for (int y = 0; y < height; ++y) {
+        int *row = alpha.data() + y * width;
+        int sum{0};
+
+        for (int x = 0; x < qMin(radius, width); ++x) {
+            sum += row[x];
+        }
+
+        for (int x = 0; x < width; ++x) {
+            if (x + radius < width) {
+                sum += row[x + radius];
+            }
+
+            if (x - radius - 1 >= 0) {
+                sum -= row[x - radius - 1];
+            }
+
+            line[x] = sum / span;
+        }
+
+        std::copy(line.constBegin(), line.constBegin() + width, row);
+    }
+
+    for (int x = 0; x < width; ++x) {
+        int *column = alpha.data() + x;
+        int sum{0};
+
+        for (int y = 0; y < qMin(radius, height); ++y) {
+            sum += column[y * width];
+        }
+
+        for (int y = 0; y < height; ++y) {
+            if (y + radius < height) {
+                sum += column[(y + radius) * width];
+            }
+
+            if (y - radius - 1 >= 0) {
+                sum -= column[(y - radius - 1) * width];
+            }
+
+            line[y] = sum / span;
+        }
+
+        for (int y = 0; y < height; ++y) {
+            column[y * width] = line[y];
+        }
+    }
+}
+
+//! a pill shaped mask whose corner that is closest to the bounds corners remains square
+QPainterPath badgeMaskPath(const QRectF &mask, const QRectF &bounds)
+{
+    const qreal radius = qMin(mask.width(), mask.height()) / 2;
+    const QSizeF quarter(mask.width() / 2, mask.height() / 2);
+
+    const QPointF maskCorners[4] = {mask.topLeft(), mask.topRight(), mask.bottomLeft(), mask.bottomRight()};
+    const QPointF boundsCorners[4] = {bounds.topLeft(), bounds.topRight(), bounds.bottomLeft(), bounds.bottomRight()};
+
+    int corner{0};
+    qreal cornerDistance{-1};
+
+    for (int i = 0; i < 4; ++i) {
+        const qreal distance = (maskCorners[i] - boundsCorners[i]).manhattanLength();
+
+        if (cornerDistance < 0 || distance < cornerDistance) {
+            corner = i;
+            cornerDistance = distance;
+        }
+    }
+
+    const QPointF quarterTopLeft(corner % 2 == 0 ? mask.left() : mask.center().x(),
+                                 corner < 2 ? mask.top() : mask.center().y());
+
+    QPainterPath path;
+    path.setFillRule(Qt::WindingFill);
+    path.addRoundedRect(mask, radius, radius);
+    path.addRect(QRectF(quarterTopLeft, quarter));
+
+    return path;
+}
+
+QImage shadowedImage(const QImage &source, const QColor &color, const int radius, const int verticalOffset, const bool withIcon)
+{
+    const QImage icon = source.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    const int width = icon.width();
+    const int height = icon.height();
+
+    //! alpha values are kept in 8.8 fixed point in order to not lose precision between passes
+    QVector<int> alpha(width * height, 0);
+
+    for (int y = qMax(0, verticalOffset); y < qMin(height, height + verticalOffset); ++y) {
+        const QRgb *iconLine = reinterpret_cast<const QRgb *>(icon.constScanLine(y - verticalOffset));
+        int *alphaLine = alpha.data() + y * width;
+
+        for (int x = 0; x < width; ++x) {
+            alphaLine[x] = qAlpha(iconLine[x]) << 8;
+        }
+    }
+
+    //! three box blur passes are a close approximation of the gaussian blur
+    const int boxRadius = qMax(1, qRound(radius * 0.3));
+
+    for (int i = 0; i < 3; ++i) {
+        boxBlur(alpha, width, height, boxRadius);
+    }
+
+    QImage result(width, height, QImage::Format_ARGB32_Premultiplied);
+    result.setDevicePixelRatio(source.devicePixelRatio());
+
+    for (int y = 0; y < height; ++y) {
+        QRgb *resultLine = reinterpret_cast<QRgb *>(result.scanLine(y));
+        const int *alphaLine = alpha.constData() + y * width;
+
+        for (int x = 0; x < width; ++x) {
+            const int shadowAlpha = qBound(0, ((alphaLine[x] >> 8) * color.alpha()) / 255, 255);
+            resultLine[x] = qPremultiply(qRgba(color.red(), color.green(), color.blue(), shadowAlpha));
+        }
+    }
+
+    if (withIcon) {
+        QPainter painter(&result);
+        painter.drawImage(QPoint(0, 0), icon);
+    }
+
+    return result;
+}
+}
+
 IconItem::IconItem(QQuickItem *parent)
     : QQuickItem(parent),
       m_lastValidSourceName(QString()),
@@ -64,6 +258,10 @@ IconItem::IconItem(QQuickItem *parent)
             this, SLOT(schedulePixmapUpdate()));
     connect(this, SIGNAL(providesColorsChanged()),
             this, SLOT(schedulePixmapUpdate()));
+    connect(KIconLoader::global(), &KIconLoader::iconLoaderSettingsChanged, this, []() {
+        //! icon theme changed, all shadowed icons must be rendered again
+        shadowedIcons().clear();
+    });
 
     //initialize implicit size to the Dialog size
     setImplicitWidth(KIconLoader::global()->currentSize(KIconLoader::Dialog));
@@ -109,6 +307,10 @@ void IconItem::setSource(const QVariant &source)
                 m_svgIcon->setUsingRenderingCache(false);
                 m_svgIcon->setDevicePixelRatio((window() ? window()->devicePixelRatio() : qApp->devicePixelRatio()));
                 connect(m_svgIcon.get(), &Plasma::Svg::repaintNeeded, this, &IconItem::schedulePixmapUpdate);
+                connect(m_svgIcon.get(), &Plasma::Svg::repaintNeeded, this, [this]() {
+                    //! theme or colors of the svg changed, its shadowed icons must be rendered again
+                    removeShadowedIcons(shadowedIconSource());
+                });
             }
 
             if (m_usesPlasmaTheme) {
@@ -347,6 +549,204 @@ void IconItem::setUsesPlasmaTheme(bool usesPlasmaTheme)
     emit usesPlasmaThemeChanged();
 }
 
+QVariantList IconItem::badgeMasks() const
+{
+    return m_badgeMasks;
+}
+
+void IconItem::setBadgeMasks(const QVariantList &masks)
+{
+    if (m_badgeMasks == masks) {
+        return;
+    }
+
+    m_badgeMasks = masks;
+
+    if (isComponentComplete()) {
+        schedulePixmapUpdate();
+    }
+
+    emit badgeMasksChanged();
+}
+
+void IconItem::applyBadgeMasks(QPixmap &pixmap) const
+{
+    QImage image = pixmap.toImage().convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    const qreal devicePixelRatio = image.devicePixelRatio();
+    image.setDevicePixelRatio(1);
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
+    //! masks are relative to the icon size, map them on the icon raster
+    painter.scale(image.width(), image.height());
+
+    for (const auto &mask : m_badgeMasks) {
+        painter.fillPath(badgeMaskPath(mask.toRectF(), QRectF(0, 0, 1, 1)), Qt::black);
+    }
+
+    painter.end();
+
+    image.setDevicePixelRatio(devicePixelRatio);
+    pixmap = QPixmap::fromImage(image);
+}
+
+bool IconItem::shadowEnabled() const
+{
+    return m_shadowEnabled;
+}
+
+void IconItem::setShadowEnabled(const bool enabled)
+{
+    if (m_shadowEnabled == enabled) {
+        return;
+    }
+
+    m_shadowEnabled = enabled;
+
+    if (isComponentComplete()) {
+        schedulePixmapUpdate();
+    }
+
+    emit shadowEnabledChanged();
+}
+
+QColor IconItem::shadowColor() const
+{
+    return m_shadowColor;
+}
+
+void IconItem::setShadowColor(const QColor &color)
+{
+    if (m_shadowColor == color) {
+        return;
+    }
+
+    m_shadowColor = color;
+
+    if (isComponentComplete() && m_shadowEnabled) {
+        schedulePixmapUpdate();
+    }
+
+    emit shadowColorChanged();
+}
+
+int IconItem::shadowSize() const
+{
+    return m_shadowSize;
+}
+
+void IconItem::setShadowSize(const int size)
+{
+    if (m_shadowSize == size) {
+        return;
+    }
+
+    m_shadowSize = size;
+
+    if (isComponentComplete() && m_shadowEnabled) {
+        schedulePixmapUpdate();
+    }
+
+    emit shadowSizeChanged();
+}
+
+int IconItem::shadowVerticalOffset() const
+{
+    return m_shadowVerticalOffset;
+}
+
+void IconItem::setShadowVerticalOffset(const int offset)
+{
+    if (m_shadowVerticalOffset == offset) {
+        return;
+    }
+
+    m_shadowVerticalOffset = offset;
+
+    if (isComponentComplete() && m_shadowEnabled) {
+        schedulePixmapUpdate();
+    }
+
+    emit shadowVerticalOffsetChanged();
+}
+
+bool IconItem::shadowOnly() const
+{
+    return m_shadowOnly;
+}
+
+void IconItem::setShadowOnly(const bool only)
+{
+    if (m_shadowOnly == only) {
+        return;
+    }
+
+    m_shadowOnly = only;
+
+    if (isComponentComplete()) {
+        schedulePixmapUpdate();
+    }
+
+    emit shadowOnlyChanged();
+}
+
+bool IconItem::hasShadow() const
+{
+    return m_shadowEnabled && m_shadowSize > 0 && m_shadowColor.alpha() > 0;
+}
+
+QString IconItem::shadowedIconSource() const
+{
+    //! named icons are shared between items, unnamed icons and images are identified by their data
+    if (m_svgIcon && !m_svgIconName.isEmpty()) {
+        return QLatin1String("svg:") + m_svgIcon->imagePath() + QLatin1Char('#') + m_svgIconName;
+    } else if (!m_icon.isNull()) {
+        return m_icon.name().isEmpty() ? QLatin1String("icon:") + QString::number(m_icon.cacheKey())
+                                       : QLatin1String("theme:") + m_icon.name();
+    } else if (!m_imageIcon.isNull()) {
+        return QLatin1String("image:") + QString::number(m_imageIcon.cacheKey());
+    }
+
+    return QString();
+}
+
+QString IconItem::shadowedIconId(const int pixelSize) const
+{
+    const QString source = shadowedIconSource();
+
+    if (source.isEmpty()) {
+        //! sources that can not be identified are never shared
+        return QString();
+    }
+
+    //! overlays and the enabled/active state are applied on the icon raster, so they are part of the id
+    const int state = !isEnabled() ? KIconLoader::DisabledState : (m_active ? KIconLoader::ActiveState : KIconLoader::DefaultState);
+
+    //! masks are relative to the icon size, so they are shared between zoom steps
+    QStringList masks;
+
+    for (const auto &mask : m_badgeMasks) {
+        const QRectF rect = mask.toRectF();
+        masks << QString::number(rect.x()) + QLatin1Char(',') + QString::number(rect.y())
+                 + QLatin1Char(',') + QString::number(rect.width()) + QLatin1Char(',') + QString::number(rect.height());
+    }
+
+    //! plain concatenation, source names may contain placeholders that QString::arg() would replace
+    const QLatin1Char separator('|');
+
+    return source
+            + separator + QString::number(pixelSize)
+            + separator + QString::number(m_shadowColor.rgba())
+            + separator + QString::number(m_shadowSize)
+            + separator + QString::number(m_shadowVerticalOffset)
+            + separator + (m_shadowOnly ? QLatin1Char('s') : QLatin1Char('i'))
+            + separator + QString::number(state)
+            + separator + QString::number(static_cast<int>(m_colorGroup))
+            + separator + m_overlays.join(QLatin1Char(','))
+            + separator + masks.join(QLatin1Char(';'));
+}
+
 void IconItem::updatePolish()
 {
     QQuickItem::updatePolish();
@@ -357,7 +757,10 @@ QSGNode *IconItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *update
 {
     Q_UNUSED(updatePaintNodeData)
 
-    if (m_iconPixmap.isNull() || width() < 1.0 || height() < 1.0) {
+    //! shadowOnly items paint nothing when there is no shadow
+    const bool hasContent = m_shadowOnly ? !m_shadowedIcon.isNull() : (!m_iconPixmap.isNull() || !m_shadowedIcon.isNull());
+
+    if (!hasContent || width() < 1.0 || height() < 1.0) {
         delete oldNode;
         return nullptr;
     }
@@ -369,7 +772,8 @@ QSGNode *IconItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *update
             delete oldNode;
 
         textureNode = new ManagedTextureNode;
-        textureNode->setTexture(QSharedPointer<QSGTexture>(window()->createTextureFromImage(m_iconPixmap.toImage(), QQuickWindow::TextureCanUseAtlas)));
+        const QImage image = !m_shadowedIcon.isNull() ? m_shadowedIcon : m_iconPixmap.toImage();
+        textureNode->setTexture(QSharedPointer<QSGTexture>(window()->createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas)));
         textureNode->setFiltering(smooth() ? QSGTexture::Linear : QSGTexture::Nearest);
 
         m_sizeChanged = true;
@@ -482,12 +886,44 @@ void IconItem::loadPixmap()
         return;
     }
 
-    const auto size = qMin(width(), height());
+    const bool shadowed = hasShadow();
+    const qreal devicePixelRatio = window() ? window()->devicePixelRatio() : qApp->devicePixelRatio();
+    const auto itemSize = qMin(width(), height());
+    //! shadowed icons are rendered at the next size step and they are scaled down while painted
+    const auto size = shadowed ? qCeil(itemSize / SHADOWSIZESTEP) * SHADOWSIZESTEP : itemSize;
     //final pixmap to paint
     QPixmap result;
+    QString shadowedId;
 
-    if (size <= 0) {
+    if (m_shadowOnly && !shadowed) {
         m_iconPixmap = QPixmap();
+        m_shadowedIcon = QImage();
+        update();
+        return;
+    }
+
+    if (shadowed && itemSize > 0) {
+        shadowedId = shadowedIconId(qRound(size * devicePixelRatio));
+        const bool colorsAreOutdated = m_providesColors && m_lastLoadedSourceId != m_lastColorsSourceId;
+
+        if (!colorsAreOutdated && !shadowedId.isEmpty() && shadowedIcons().contains(shadowedId)) {
+            const ShadowedIconData *cached = shadowedIcons().object(shadowedId);
+
+            m_iconPixmap = cached->icon;
+
+            if (cached->shadowed.cacheKey() != m_shadowedIcon.cacheKey()) {
+                m_shadowedIcon = cached->shadowed;
+                m_textureChanged = true;
+            }
+
+            update();
+            return;
+        }
+    }
+
+    if (itemSize <= 0) {
+        m_iconPixmap = QPixmap();
+        m_shadowedIcon = QImage();
         update();
         return;
     } else if (m_svgIcon) {
@@ -520,12 +956,12 @@ void IconItem::loadPixmap()
             result = m_svgIcon->pixmap();
         }
     } else if (!m_icon.isNull()) {
-        result = m_icon.pixmap(QSize(static_cast<int>(size), static_cast<int>(size))
-                               * (window() ? window()->devicePixelRatio() : qApp->devicePixelRatio()));
+        result = m_icon.pixmap(QSize(static_cast<int>(size), static_cast<int>(size)) * devicePixelRatio);
     } else if (!m_imageIcon.isNull()) {
         result = QPixmap::fromImage(m_imageIcon);
     } else {
         m_iconPixmap = QPixmap();
+        m_shadowedIcon = QImage();
         update();
         return;
     }
@@ -557,6 +993,27 @@ void IconItem::loadPixmap()
         updateColors();
     }
 
+    //! colors are always provided from the entire icon
+    if (!m_badgeMasks.isEmpty() && !result.isNull()) {
+        applyBadgeMasks(result);
+        m_iconPixmap = result;
+    }
+
+    if (shadowed) {
+        const int shadowSize = qRound(m_shadowSize * devicePixelRatio);
+        const int verticalOffset = qRound(m_shadowVerticalOffset * devicePixelRatio);
+
+        m_shadowedIcon = shadowedImage(result.toImage(), m_shadowColor, shadowSize, verticalOffset, !m_shadowOnly);
+
+        if (!shadowedId.isEmpty()) {
+            ShadowedIconData *data = new ShadowedIconData{m_iconPixmap, m_shadowedIcon};
+            const int cost = (m_shadowedIcon.bytesPerLine() * m_shadowedIcon.height() + m_iconPixmap.width() * m_iconPixmap.height() * 4) / 1024;
+            shadowedIcons().insert(shadowedId, data, qMax(1, cost));
+        }
+    } else {
+        m_shadowedIcon = QImage();
+    }
+
     m_textureChanged = true;
     //don't animate initial setting
     update();
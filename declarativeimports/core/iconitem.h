@@ -108,6 +108,41 @@ class IconItem : public QQuickItem
      */
     Q_PROPERTY(QString lastValidSourceName READ lastValidSourceName NOTIFY lastValidSourceNameChanged)
 
+    /**
+     * If set, icon is painted together with a drop shadow that is baked
+     * into its texture instead of using a separate shadow effect item
+     */
+    Q_PROPERTY(bool shadowEnabled READ shadowEnabled WRITE setShadowEnabled NOTIFY shadowEnabledChanged)
+
+    /**
+     * The color of the baked drop shadow
+     */
+    Q_PROPERTY(QColor shadowColor READ shadowColor WRITE setShadowColor NOTIFY shadowColorChanged)
+
+    /**
+     * The blur radius of the baked drop shadow
+     */
+    Q_PROPERTY(int shadowSize READ shadowSize WRITE setShadowSize NOTIFY shadowSizeChanged)
+
+    /**
+     * The vertical offset of the baked drop shadow
+     */
+    Q_PROPERTY(int shadowVerticalOffset READ shadowVerticalOffset WRITE setShadowVerticalOffset NOTIFY shadowVerticalOffsetChanged)
+
+    /**
+     * If set, only the baked drop shadow is painted without the icon. It is used
+     * under a plain icon item whose texture is used from effects
+     */
+    Q_PROPERTY(bool shadowOnly READ shadowOnly WRITE setShadowOnly NOTIFY shadowOnlyChanged)
+
+    /**
+     * Areas of the icon that are cut out in order to leave room for badges drawn
+     * on top of it. Each mask is a rect relative to the icon size, from 0 to 1,
+     * that is cut out as a pill whose corner closest to the icon corner remains square.
+     * Relative masks do not change while the icon is zoomed
+     */
+    Q_PROPERTY(QVariantList badgeMasks READ badgeMasks WRITE setBadgeMasks NOTIFY badgeMasksChanged)
+
     Q_PROPERTY(QColor backgroundColor READ backgroundColor NOTIFY backgroundColorChanged)
     Q_PROPERTY(QColor glowColor READ glowColor NOTIFY glowColorChanged)
 public:
@@ -137,6 +172,24 @@ public:
     bool usesPlasmaTheme() const;
     void setUsesPlasmaTheme(bool usesPlasmaTheme);
 
+    QVariantList badgeMasks() const;
+    void setBadgeMasks(const QVariantList &masks);
+
+    bool shadowEnabled() const;
+    void setShadowEnabled(const bool enabled);
+
+    QColor shadowColor() const;
+    void setShadowColor(const QColor &color);
+
+    int shadowSize() const;
+    void setShadowSize(const int size);
+
+    int shadowVerticalOffset() const;
+    void setShadowVerticalOffset(const int offset);
+
+    bool shadowOnly() const;
+    void setShadowOnly(const bool only);
+
     int paintedWidth() const;
     int paintedHeight() const;
 
@@ -157,12 +210,18 @@ public:
 signals:
     void activeChanged();
     void backgroundColorChanged();
+    void badgeMasksChanged();
     void colorGroupChanged();
     void glowColorChanged();
     void lastValidSourceNameChanged();
     void overlaysChanged();
     void paintedSizeChanged();
     void providesColorsChanged();
+    void shadowColorChanged();
+    void shadowEnabledChanged();
+    void shadowOnlyChanged();
+    void shadowSizeChanged();
+    void shadowVerticalOffsetChanged();
     void smoothChanged();
     void sourceChanged();
     void usesPlasmaThemeChanged();
@@ -180,9 +239,17 @@ private:
     void setBackgroundColor(QColor background);
     void setGlowColor(QColor glow);
 
+    void applyBadgeMasks(QPixmap &pixmap) const;
+
+    bool hasShadow() const;
+    QString shadowedIconSource() const;
+    QString shadowedIconId(const int pixelSize) const;
+
 private:
     bool m_active;
     bool m_providesColors{false};
+    bool m_shadowEnabled{false};
+    bool m_shadowOnly{false};
     bool m_smooth;
 
 
@@ -192,9 +259,16 @@ private:
 
     QColor m_backgroundColor;
     QColor m_glowColor;
+    QColor m_shadowColor{Qt::black};
+
+    int m_shadowSize{0};
+    int m_shadowVerticalOffset{0};
 
     QIcon m_icon;
     QPixmap m_iconPixmap;
+    //! icon together with its drop shadow, or only the shadow for shadowOnly items,
+    //! it is painted instead of m_iconPixmap when it is valid
+    QImage m_shadowedIcon;
     QImage m_imageIcon;
     std::unique_ptr<Plasma::Svg> m_svgIcon;
     QString m_svgIconName;
@@ -216,6 +290,8 @@ private:
 
     QStringList m_overlays;
 
+    QVariantList m_badgeMasks;
+
     Plasma::Theme::ColorGroup m_colorGroup;
 
     //this contains the raw variant it was passed
@@ -21,13 +21,14 @@ import QtQuick 2.2
 
 import org.kde.plasma.private.volume 0.1
 
+import org.kde.latte.private.tasks 0.1 as LatteTasks
+
 QtObject {
     id: pulseAudio
 
-    signal streamsChanged
-
-    // It's a JS object so we can do key lookup and don't need to take care of filtering duplicates.
-    property var pidMatches: ({})
+    // Streams are indexed by pid and application name, tasks subscribe to
+    // the index and are updated only when their own streams change.
+    property var streamsIndex: LatteTasks.AudioStreamsIndex {}
 
     property int maxVolumePercent: 125
     property int maxVolumeValue: Math.round(maxVolumePercent * PulseAudio.NormalVolume / 100.0)
@@ -37,43 +38,6 @@ QtObject {
         return Math.max(PulseAudio.MinimalVolume, Math.min(volume, maxVolumeValue));
     }
 
-    // TODO Evict cache at some point, preferably if all instances of an application closed.
-    function registerPidMatch(appName) {
-        if (!hasPidMatch(appName)) {
-            pidMatches[appName] = true;
-
-            // In case this match is new, notify that streams might have changed.
-            // This way we also catch the case when the non-playing instance
-            // shows up first.
-            // Only notify if we changed to avoid infinite recursion.
-            streamsChanged();
-        }
-    }
-
-    function hasPidMatch(appName) {
-        return pidMatches[appName] === true;
-    }
-
-    function findStreams(key, value) {
-        var streams = []
-        for (var i = 0, length = instantiator.count; i < length; ++i) {
-            var stream = instantiator.objectAt(i);
-            if (stream[key] === value
-                    || (key==="appName" && stream[key].toLowerCase() === value.toLowerCase())) {
-                streams.push(stream);
-            }
-        }
-        return streams
-    }
-
-    function streamsForAppName(appName) {
-        return findStreams("appName", appName);
-    }
-
-    function streamsForPid(pid) {
-        return findStreams("pid", pid);
-    }
-
     // QtObject has no default property, hence adding the Instantiator to one explicitly.
     property var instantiator: Instantiator {
         model: PulseObjectFilterModel {
@@ -82,6 +46,7 @@ QtObject {
         }
 
         delegate: QtObject {
+            id: stream
             readonly property int pid: Client ? Client.properties["application.process.id"] : 0
             readonly property string appName: Client ? Client.properties["application.name"] : ""
             readonly property bool muted: Muted
@@ -90,6 +55,9 @@ QtObject {
             readonly property int volume: Math.round(pulseVolume / PulseAudio.NormalVolume * 100.0)
             readonly property int pulseVolume: Volume
 
+            onPidChanged: pulseAudio.streamsIndex.setStream(stream, pid, appName)
+            onAppNameChanged: pulseAudio.streamsIndex.setStream(stream, pid, appName)
+
             function mute() {
                 Muted = true
             }
@@ -108,8 +76,8 @@ QtObject {
             }
         }
 
-        onObjectAdded: pulseAudio.streamsChanged()
-        onObjectRemoved: pulseAudio.streamsChanged()
+        onObjectAdded: pulseAudio.streamsIndex.setStream(object, object.pid, object.appName)
+        onObjectRemoved: pulseAudio.streamsIndex.removeStream(object)
     }
 
     Component.onCompleted: {
@@ -22,6 +22,8 @@ import QtQuick 2.0
 
 import org.kde.plasma.plasmoid 2.0
 
+import org.kde.latte.private.tasks 0.1 as LatteTasks
+
 //! Trying to WORKAROUND all the Plasma LibTaskManager limitations
 //! concerning Tasks AND Launchers.
 //!
@@ -36,246 +38,100 @@ import org.kde.plasma.plasmoid 2.0
 Item {
     id: tasksExtManager
 
-    /// Launchers that are playing an ADD or REMOVAL animation
-    /// and their Starups/Windows should be aware of
-    property variant waitingLaunchers: []
-
-    //! Launchers that must be shown IMMEDIATELY after a window removal
-    //! because they are already present from a present libtaskmanager state
-    property variant immediateLaunchers: []
-
-    //! New launchers in order to be moved in correct place:
-    //! launcher, pos)
-    property variant launchersToBeMoved: []
-
-    //! Launchers that are added from user actions. They can be used in order
-    //! to provide addition animations properly
-    property variant launchersToBeAdded: []
-
-    //! Launchers that are added from user actions. They can be used in order
-    //! to provide removal animations properly
-    property variant launchersToBeRemoved: []
-
-    //! Tasks that change state (launcher,startup,window) and
-    //! at the next state must look the same concerning the parabolic effect:
-    //! (id, zoom)
-    property variant frozenTasks: []
-
-    property int launchersToBeRemovedCount: 0 //is used to update instantly relevant bindings
+    readonly property int launchersToBeRemovedCount: tracker.launchersToBeRemovedCount //is used to update instantly relevant bindings
 
     signal waitingLauncherRemoved(string launch);
 
+    //! launchers and tasks records are kept in c++ hashes and each one of them
+    //! expires on its own after a specified interval. Records may be ghosts that
+    //! were not used from animations or other plasmoid parts. Each record is usually
+    //! only a matter of secs to be used, cleaning them after a big interval is safe
+    LatteTasks.LaunchersTracker {
+        id: tracker
+        onWaitingLauncherRemoved: tasksExtManager.waitingLauncherRemoved(launcher);
+    }
 
     /////////// FUNCTIONALITY ////////////////////
 
 
     /// WAITING LAUNCHERS
     function addWaitingLauncher(launch){
-        arraysGarbageCollectorTimer.restart();
-
-        if (waitingLauncherExists(launch)) {
-            return;
-        }
-
-        waitingLaunchers.push(launch);
+        tracker.addWaitingLauncher(launch);
     }
 
     function removeWaitingLauncher(launch){
-        for(var i=0; i<waitingLaunchers.length; ++i){
-            if (equals(waitingLaunchers[i], launch)) {
-                waitingLaunchers.splice(i,1);
-                waitingLauncherRemoved(launch);
-                return;
-            }
-        }
+        tracker.removeWaitingLauncher(launch);
     }
 
     function waitingLauncherExists(launch){
-        for(var i=0; i<waitingLaunchers.length; ++i){
-            if (equals(waitingLaunchers[i], launch)) {
-                return true;
-            }
-        }
-
-        return false;
-    }
-
-    function equals(waitingLauncher, launcher) {
-        var equals = ( launcher !== ""
-                      && waitingLauncher !== ""
-                      && (launcher.indexOf(waitingLauncher) >= 0 || waitingLauncher.indexOf(launcher) >= 0));
-
-        return equals;
+        return tracker.waitingLauncherExists(launch);
     }
 
     function waitingLaunchersLength() {
-        return waitingLaunchers.length;
-    }
-
-    function printWaitingLaunchers() {
-        console.log("WAITING LAUNCHERS ::: " + waitingLaunchers);
+        return tracker.waitingLaunchersLength();
     }
 
     //! LAUNCHERSTOBEADDED
     function addToBeAddedLauncher(launcher){
-        arraysGarbageCollectorTimer.restart();
-
-        if (toBeAddedLauncherExists(launcher)) {
-            return;
-        }
-
-        launchersToBeAdded.push(launcher);
+        tracker.addToBeAddedLauncher(launcher);
     }
 
     function removeToBeAddedLauncher(launcher){
-        for(var i=0; i<launchersToBeAdded.length; ++i){
-            if (equals(launchersToBeAdded[i], launcher)) {
-                launchersToBeAdded.splice(i,1);
-                return;
-            }
-        }
+        tracker.removeToBeAddedLauncher(launcher);
     }
 
     function toBeAddedLauncherExists(launcher) {
-        for(var i=0; i<launchersToBeAdded.length; ++i){
-            if (equals(launchersToBeAdded[i], launcher)) {
-                return true;
-            }
-        }
-
-        return false;
-    }
-
-
-    function printToBeAddedLaunchers() {
-        console.log("TO BE ADDED LAUNCHERS ::: " + launchersToBeAdded);
+        return tracker.toBeAddedLauncherExists(launcher);
     }
 
     //! LAUNCHERSTOBEREMOVED
     function addToBeRemovedLauncher(launcher){
-        arraysGarbageCollectorTimer.restart();
-
-        if (isLauncherToBeRemoved(launcher)) {
-            return;
-        }
-
-        launchersToBeRemoved.push(launcher);
-        launchersToBeRemovedCount++;
+        tracker.addToBeRemovedLauncher(launcher);
     }
 
     function removeToBeRemovedLauncher(launcher){
-        if (!isLauncherToBeRemoved(launcher)) {
-            return;
-        }
-
-        for(var i=0; i<launchersToBeRemoved.length; ++i){
-            if (launchersToBeRemoved[i] === launcher) {
-                launchersToBeRemoved.splice(i,1);
-                launchersToBeRemovedCount--;
-                return;
-            }
-        }
+        tracker.removeToBeRemovedLauncher(launcher);
     }
 
     function isLauncherToBeRemoved(launcher) {
-        return launchersToBeRemoved.indexOf(launcher)>=0;
-    }
-
-
-    function printToBeRemovedLaunchers() {
-        console.log("TO BE REMOVED LAUNCHERS ::: " + launchersToBeRemoved);
+        return tracker.isLauncherToBeRemoved(launcher);
     }
 
     //! IMMEDIATELAUNCHERS
     function addImmediateLauncher(launch){
-        arraysGarbageCollectorTimer.restart();
-
-        if (!immediateLauncherExists(launch)) {
-            //console.log("Immediate Launcher Added::: "+launch);
-            immediateLaunchers.push(launch);
-        }
+        tracker.addImmediateLauncher(launch);
     }
 
     function removeImmediateLauncher(launch){
-        for(var i=0; i<immediateLaunchers.length; ++i){
-            if (immediateLaunchers[i]===launch) {
-                immediateLaunchers.splice(i,1);
-                //console.log("Immediate Launcher Removed::: "+launch);
-                return;
-            }
-        }
+        tracker.removeImmediateLauncher(launch);
     }
 
     function immediateLauncherExists(launch){
-        for(var i=0; i<immediateLaunchers.length; ++i){
-            if (immediateLaunchers[i]===launch) {
-                return true;
-            }
-        }
-
-        return false;
-    }
-
-    function printImmediateLaunchers() {
-        console.log("IMMEDIATE LAUNCHERS ::: " + immediateLaunchers);
+        return tracker.immediateLauncherExists(launch);
     }
-    //!
 
     //! FROZENTASKS
     function getFrozenTask(identifier) {
-        for(var i=0; i<frozenTasks.length; ++i) {
-            if (frozenTasks[i].id === identifier) {
-                return frozenTasks[i];
-            }
+        var zoom = tracker.frozenTaskZoom(identifier);
+
+        if (zoom >= 0) {
+            return {id: identifier, zoom: zoom};
         }
     }
 
     function removeFrozenTask(identifier) {
-        var taskIndex = -1;
-        for(var i=0; i<frozenTasks.length; ++i) {
-            if (frozenTasks[i].id === identifier) {
-                taskIndex = i;
-            }
-        }
-
-        if (taskIndex > -1) {
-            frozenTasks.splice(taskIndex, 1);
-        }
+        tracker.removeFrozenTask(identifier);
     }
 
     function setFrozenTask(identifier, scale) {
-        arraysGarbageCollectorTimer.restart();
-
-        var frozenTaskExists = false;
-        console.log("SET FROZEN :: "+identifier+" - "+scale);
-        var frozenTask = getFrozenTask(identifier);
-
-        if (frozenTask) {
-            frozenTask.zoom = scale;
-        } else {
-            frozenTasks.push({id: identifier, zoom: scale});
-        }
-    }
-
-    function printFrozenTasks() {
-        var fzTasks= "";
-
-        for(var i=0; i<frozenTasks.length; ++i) {
-            fzTasks = frozenTasks[i].id + "," + frozenTasks[i].zoom + "__";
-        }
-
-        console.log("FROZEN TASKS ::: " + fzTasks);
+        tracker.setFrozenTask(identifier, scale);
     }
 
     //! LAUNCHERSTOBEMOVED
 
     //! launchersToBeMoved, new launchers to have been added and must be repositioned
     function addLauncherToBeMoved(launcherUrl, toPos) {
-        arraysGarbageCollectorTimer.restart();
-
-        if (!isLauncherToBeMoved(launcherUrl)) {
-            launchersToBeMoved.push({launcher: launcherUrl, pos: Math.max(0,toPos)});
-        }
+        tracker.addLauncherToBeMoved(launcherUrl, toPos);
     }
 
     function moveLauncherToCorrectPos(launcherUrl, from) {
@@ -290,55 +146,15 @@ Item {
     }
 
     function removeLauncherToBeMoved(launcherUrl) {
-        if (isLauncherToBeMoved(launcherUrl)) {
-            var sLength = launchersToBeMoved.length;
-            var index = -1;
-
-            for (var i=0; i<sLength; ++i) {
-                //!safety checker
-                if (i>=launchersToBeMoved.length)
-                    return -1;
-
-                if (launchersToBeMoved[i].launcher === launcherUrl) {
-                    index = i;
-                    break;
-                }
-            }
-
-            if (index > -1) {
-                // console.log("removing launcher to be moved:: "+launcherUrl);
-                launchersToBeMoved.splice(index, 1);
-            }
-        }
+        tracker.removeLauncherToBeMoved(launcherUrl);
     }
 
     function posOfLauncherToBeMoved(launcherUrl) {
-        var sLength = launchersToBeMoved.length;
-
-        for (var i=0; i<sLength; ++i) {
-            //!safety checker
-            if (i>=launchersToBeMoved.length)
-                return -1;
-
-            if (launchersToBeMoved[i].launcher === launcherUrl)
-                return launchersToBeMoved[i].pos;
-        }
-
-        return -1;
+        return tracker.posOfLauncherToBeMoved(launcherUrl);
     }
 
     function isLauncherToBeMoved(launcher) {
-        return (posOfLauncherToBeMoved(launcher) >= 0);
-    }
-
-    function printToBeMovedLaunchers() {
-        var tbmLaunchers= "";
-
-        for(var i=0; i<launchersToBeMoved.length; ++i) {
-            tbmLaunchers = launchersToBeMoved[i].launcher + "," + launchersToBeMoved[i].pos + "__";
-        }
-
-        console.log("TO BE MOVED LAUNCHERS ::: " + tbmLaunchers);
+        return tracker.isLauncherToBeMoved(launcher);
     }
 
     //! Connections
@@ -376,30 +192,4 @@ Item {
             appletAbilities.launchers.validateSyncedLaunchersOrder();
         }
     }
-
-
-    //! Timer to clean up all arrays used from TasksExtendedManager after a specified interval
-    //! The arrays may have ghost records that were not used from animations or other plasmoid parts.
-    //! Each record of the arrays is usually only a matter of secs to be used, cleaning them after
-    //! a big interval from the last addition it is safe
-    Timer {
-        id: arraysGarbageCollectorTimer
-        interval: 30 * 1000
-        onTriggered: {
-            console.log(" TASKS EXTENDED MANAGER Garbage Collector...");
-            tasksExtManager.printImmediateLaunchers();
-            tasksExtManager.printToBeAddedLaunchers();
-            tasksExtManager.printToBeMovedLaunchers();
-            tasksExtManager.printToBeRemovedLaunchers();
-            tasksExtManager.printWaitingLaunchers();
-            tasksExtManager.printFrozenTasks();
-
-            immediateLaunchers.splice(0, immediateLaunchers.length);
-            launchersToBeAdded.splice(0, launchersToBeAdded.length);
-            launchersToBeMoved.splice(0, launchersToBeMoved.length);
-            launchersToBeRemoved.splice(0, launchersToBeRemoved.length);
-            waitingLaunchers.splice(0, waitingLaunchers.length);
-            frozenTasks.splice(0, frozenTasks.length);
-        }
-    }
 }
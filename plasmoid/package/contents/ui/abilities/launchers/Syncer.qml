@@ -29,6 +29,10 @@ Item {
     readonly property bool isActive: bridge !== null && bridge.launchers.host !==null && group !== LatteCore.Types.UniqueLaunchers
     readonly property int clientId: plasmoid.id
 
+    //! used from Main SyncedLaunchers handler in order to index its clients
+    readonly property int launchersGroup: group
+    readonly property string layoutName: bridge && bridge.launchers.host ? bridge.launchers.host.layoutName : ""
+
     //! Connections
     Component.onCompleted: {
         if (isActive) {
@@ -21,13 +21,13 @@ import QtQuick.Window 2.6
 import org.kde.taskmanager 0.1 as TaskManager
 
 TaskManager.PipeWireSourceItem {
+    property var winId: 0
+
     visible: waylandItem.nodeId > 0
     nodeId: waylandItem.nodeId
 
-    anchors.fill: parent
-
     TaskManager.ScreencastingRequest {
         id: waylandItem
-        uuid: !windowsPreviewDlg.visible ? "" : thumbnailSourceItem.winId
+        uuid: !windowsPreviewDlg.visible ? "" : winId
     }
 }
@@ -22,8 +22,7 @@ import QtQuick 2.6
 import org.kde.plasma.core 2.0 as PlasmaCore
 
 PlasmaCore.WindowThumbnail {
-    winId: thumbnailSourceItem.winId
-
+    //! winId is provided by the previews pool
     onWinIdChanged: {
         //! WORKAROUND, in order for toolTipDelegate to re-instantiate the previews model when
         //! previews are changing from single instance preview to another single instance
@@ -34,6 +34,9 @@ import org.kde.kquickcontrolsaddons 2.0 as KQuickControlsAddons
 
 import org.kde.taskmanager 0.1 as TaskManager
 
+import org.kde.latte.core 0.2 as LatteCore
+import org.kde.latte.private.tasks 0.1 as LatteTasks
+
 PlasmaExtras.ScrollArea {
     id: mainToolTip
     property Item parentTask
@@ -81,10 +84,35 @@ PlasmaExtras.ScrollArea {
         });
     }
 
+    //! thumbnails are shared between previews and are kept alive for a while
+    //! after they stop being shown in order to not restart their streams when
+    //! the user is moving between tasks
+    LatteTasks.PreviewsPool {
+        id: previewsPool
+        idleParent: idlePreviews
+        component: thumbnailComponent
+
+        readonly property bool thumbnailsAvailable: LatteCore.WindowSystem.isPlatformX11
+                                                    || (root.plasma520 && LatteCore.WindowSystem.isPlatformWayland)
+
+        //! the pool only guards its component, this var property keeps the created component alive.
+        //! It is created dynamically because PipeWireThumbnail can not be loaded before plasma 5.20
+        readonly property var thumbnailComponent: thumbnailsAvailable ? Qt.createComponent(root.plasma520 && LatteCore.WindowSystem.isPlatformWayland ?
+                                                                                               "PipeWireThumbnail.qml" : "PlasmaCoreThumbnail.qml") : null
+    }
+
     Item{
         width: contentItem.width
         height: contentItem.height
 
+        //! idle thumbnails are not painted but they remain visible in order to keep their streams
+        Item {
+            id: idlePreviews
+            width: 0
+            height: 0
+            opacity: 0
+        }
+
         //! DropArea
         DropArea {
             id: dropMainArea
@@ -31,6 +31,7 @@ import org.kde.plasma.extras 2.0 as PlasmaExtras
 import org.kde.kquickcontrolsaddons 2.0 as KQuickControlsAddons
 
 import org.kde.latte.core 0.2 as LatteCore
+import org.kde.latte.private.tasks 0.1 as LatteTasks
 
 import org.kde.draganddrop 2.0
 
@@ -198,13 +199,15 @@ Column {
                 pressed: hoverHandler.containsPress
             }
 
-            Loader{
+            LatteTasks.PreviewThumbnail {
                 id:previewThumbLoader
                 anchors.fill: parent
                 anchors.margins: 2
-                active: LatteCore.WindowSystem.isPlatformX11 || (root.plasma520 && LatteCore.WindowSystem.isPlatformWayland)
+                pool: previewsPool
+                winId: active ? thumbnailSourceItem.winId : 0
                 visible: !albumArtImage.visible && !thumbnailSourceItem.isMinimized
-                source: root.plasma520 && LatteCore.WindowSystem.isPlatformWayland ? "PipeWireThumbnail.qml" : "PlasmaCoreThumbnail.qml"
+
+                readonly property bool active: previewsPool.thumbnailsAvailable
             }
 
             ToolTipWindowMouseArea {
@@ -71,8 +71,8 @@ Item {
             }
             height: 0.8 * parent.height
             numberValue: {
-                if (taskIcon.smartLauncherItem && (taskIcon.smartLauncherItem.countVisible || taskIcon.smartLauncherItem.progressVisible)) {
-                    return taskIcon.smartLauncherItem.count;
+                if (taskIconContainer.smartLauncherItem && (taskIconContainer.smartLauncherItem.countVisible || taskIconContainer.smartLauncherItem.progressVisible)) {
+                    return taskIconContainer.smartLauncherItem.count;
                 } else if (taskItem.badgeIndicator > 0) {
                     return taskItem.badgeIndicator;
                 }
@@ -104,11 +104,11 @@ Item {
             textWithBackgroundColor: false
 
             proportion: {
-                if (taskIcon.smartLauncherItem && taskIcon.smartLauncherItem.progressVisible) {
-                    return taskIcon.smartLauncherItem.progress / 100;
+                if (taskIconContainer.smartLauncherItem && taskIconContainer.smartLauncherItem.progressVisible) {
+                    return taskIconContainer.smartLauncherItem.progress / 100;
                 }
 
-                if (taskItem.badgeIndicator > 0 || (taskIcon.smartLauncherItem && taskIcon.smartLauncherItem.countVisible)) {
+                if (taskItem.badgeIndicator > 0 || (taskIconContainer.smartLauncherItem && taskIconContainer.smartLauncherItem.countVisible)) {
                     return 1;
                 }
 
@@ -119,7 +119,7 @@ Item {
             readonly property color prominentTextColor: "#f3f3f3" //whitish (deprecated: root.lightTextColor)
 
             readonly property bool showsInfoBadge: ((taskItem.badgeIndicator > 0)
-                                                    || (taskIcon.smartLauncherItem && taskIcon.smartLauncherItem.countVisible && !taskIcon.smartLauncherItem.progressVisible))
+                                                    || (taskIconContainer.smartLauncherItem && taskIconContainer.smartLauncherItem.countVisible && !taskIconContainer.smartLauncherItem.progressVisible))
 
             readonly property bool showsAudioBadge: root.showAudioBadge && taskItem.hasAudioStream && taskItem.playingAudio && !taskItem.isSeparator
         }
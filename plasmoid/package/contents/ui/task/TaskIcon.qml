@@ -60,6 +60,26 @@ Item {
         onTempColorChanged: tempColor.a = 0.35;
     }
 
+    //! Shadow, it is baked from the icon and drawn under it. This way the icon remains
+    //! plain and the effects that use it as source do not colorize its shadow
+    LatteCore.IconItem {
+        id: taskIconShadow
+        anchors.fill: taskIconItem
+
+        source: taskIconItem.source
+        smooth: taskIconItem.smooth
+        badgeMasks: taskIconItem.badgeMasks
+        visible: !taskItem.isSeparator
+
+        shadowOnly: true
+        shadowEnabled: taskItem.abilities.myView.itemShadow.isEnabled
+                       && !taskItem.isSeparator
+                       && graphicsSystem.isAccelerated
+        shadowColor: taskItem.abilities.myView.itemShadow.shadowColor
+        shadowSize: taskItem.abilities.myView.itemShadow.size
+        shadowVerticalOffset: 2
+    }
+
     LatteCore.IconItem {
         id: taskIconItem
         anchors.fill: parent
@@ -68,10 +88,30 @@ Item {
         smooth: taskItem.abilities.parabolic.factor.zoom === 1 ? true : false
         providesColors: taskItem.abilities.indicators.info.needsIconColors
 
-        opacity: taskItem.abilities.myView.itemShadow.isEnabled
-                 && taskWithShadow.active
-                 && graphicsSystem.isAccelerated ? 0 : 1
-        visible: !taskItem.isSeparator && (!badgesLoader.active || !graphicsSystem.isAccelerated)
+        //! leave room for the badges that are drawn on top of the icon,
+        //! masks are relative to the icon size in order to not change during zoom
+        badgeMasks: {
+            if (!badges.active) {
+                return [];
+            }
+
+            var masks = [];
+
+            if (badges.showInfo || badges.showProgress) {
+                var infoWidth = Math.min(Math.max(badgeVisualsLoader.infoBadgeRelativeWidth, 0.5), 1);
+                masks.push(Qt.rect(badges.infoAtLeft ? 0 : 1 - infoWidth, 0, infoWidth, 0.5));
+            }
+
+            if (badges.showAudio) {
+                masks.push(Qt.rect(badges.infoAtLeft ? 0.5 : 0, 0, 0.5, 0.5));
+            }
+
+            return masks;
+        }
+
+        //! the colorized state is drawn instead of the badged icon
+        opacity: badges.active && stateColorizer.opacity > 0 ? 0 : 1
+        visible: !taskItem.isSeparator
 
         onValidChanged: {
             if (!valid && (source === decoration || source === "unknown")) {
@@ -136,181 +176,43 @@ Item {
         ]
     }
 
-    //! Shadows
-    Loader{
-        id: taskWithShadow
-        anchors.fill: taskIconContainer
-        active: taskItem.abilities.myView.itemShadow.isEnabled && !taskItem.isSeparator && graphicsSystem.isAccelerated
+    //! monochromatic badged icons when they are forced, taskIconItem does not contain
+    //! the shadow so only the icon pixels are tinted
+    Loader {
+        anchors.fill: taskIconItem
+        active: plasmoid.configuration.forceMonochromaticIcons && badges.active && !taskItem.isSeparator
+        opacity: taskIconItem.opacity
 
-        sourceComponent: DropShadow{
-            anchors.fill: parent
-            color: taskItem.abilities.myView.itemShadow.shadowColor
-            fast: true
-            samples: 2 * radius
-            source: badgesLoader.active ? badgesLoader.item : taskIconItem
-            radius: taskItem.abilities.myView.itemShadow.size
-            verticalOffset: 2
+        sourceComponent: ColorOverlay {
+            color: latteBridge ? latteBridge.palette.textColor : "transparent"
+            source: taskIconItem
         }
     }
-    //! Shadows
 
-    //! Combined Loader for Progress and Audio badges masks
-    Loader{
-        id: badgesLoader
-        anchors.fill: taskIconContainer
-        active: (activateProgress > 0) && graphicsSystem.isAccelerated
-        asynchronous: true
-        opacity: stateColorizer.opacity > 0 ? 0 : 1
+    //! Progress, Info and Audio badges states
+    Item {
+        id: badges
+        visible: false
+
+        readonly property bool active: activateProgress > 0
+
+        //! info/progress badge is placed at the left top corner and audio badge at the right top corner
+        readonly property bool infoAtLeft: (root.location === PlasmaCore.Types.RightEdge)
+                                           || (Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical)
 
         property real activateProgress: showInfo || showProgress || showAudio ? 1 : 0
 
-        property bool showInfo: (root.showInfoBadge && taskIcon.smartLauncherItem && !taskItem.isSeparator
-                                 && (taskIcon.smartLauncherItem.countVisible || taskItem.badgeIndicator > 0) && !taskIcon.smartLauncherItem.progressVisible)
+        property bool showInfo: (root.showInfoBadge && taskIconContainer.smartLauncherItem && !taskItem.isSeparator
+                                 && (taskIconContainer.smartLauncherItem.countVisible || taskItem.badgeIndicator > 0) && !taskIconContainer.smartLauncherItem.progressVisible)
 
-        property bool showProgress: root.showProgressBadge && taskIcon.smartLauncherItem && !taskItem.isSeparator
-                                    && taskIcon.smartLauncherItem.progressVisible
+        property bool showProgress: root.showProgressBadge && taskIconContainer.smartLauncherItem && !taskItem.isSeparator
+                                    && taskIconContainer.smartLauncherItem.progressVisible
 
         property bool showAudio: (root.showAudioBadge && taskItem.hasAudioStream && taskItem.playingAudio && !taskItem.isSeparator)
 
         Behavior on activateProgress {
             NumberAnimation { duration: 2 * taskItem.abilities.animations.speedFactor.current * taskItem.abilities.animations.duration.large }
         }
-
-        sourceComponent: Item{
-            ShaderEffect {
-                id: iconOverlay
-                enabled: false
-                anchors.fill: parent
-                property var source: ShaderEffectSource {
-                    sourceItem: LatteCore.IconItem{
-                        width: taskIconContainer.width
-                        height: taskIconContainer.height
-                        source: taskIconItem.source
-
-                        Loader{
-                            anchors.fill: parent
-                            active: plasmoid.configuration.forceMonochromaticIcons
-
-                            sourceComponent: ColorOverlay {
-                                anchors.fill: parent
-                                color: latteBridge ? latteBridge.palette.textColor : "transparent"
-                                source: taskIconItem
-                            }
-                        }
-                    }
-                }
-                property var mask: ShaderEffectSource {
-                    sourceItem: Item{
-                        LayoutMirroring.enabled: Qt.application.layoutDirection === Qt.RightToLeft && !root.vertical
-                        LayoutMirroring.childrenInherit: true
-
-                        width: taskIconContainer.width
-                        height: taskIconContainer.height
-
-                        Rectangle{
-                            id: maskRect
-                            width: Math.max(badgeVisualsLoader.infoBadgeWidth, parent.width / 2)
-                            height: parent.height / 2
-                            radius: parent.height
-                            visible: badgesLoader.showInfo || badgesLoader.showProgress
-
-                            //! Removes any remainings from the icon around the roundness at the corner
-                            Rectangle{
-                                id: maskCorner
-                                width: parent.width/2
-                                height: parent.height/2
-                            }
-
-                            states: [
-                                State {
-                                    name: "default"
-                                    when: (root.location !== PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                },
-                                State {
-                                    name: "right"
-                                    when: (root.location === PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                }
-                            ]
-                        } // progressMask
-
-                        Rectangle{
-                            id: maskRect2
-                            width: parent.width/2
-                            height: width
-                            radius: width
-                            visible: badgesLoader.showAudio
-
-                            Rectangle{
-                                id: maskCorner2
-                                width:parent.width/2
-                                height:parent.height/2
-                            }
-
-                            states: [
-                                State {
-                                    name: "default"
-                                    when: (root.location !== PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect2
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner2
-                                        anchors{ top:parent.top; bottom:undefined; left:parent.left; right:undefined;}
-                                    }
-                                },
-                                State {
-                                    name: "right"
-                                    when: (root.location === PlasmaCore.Types.RightEdge)
-
-                                    AnchorChanges {
-                                        target: maskRect2
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                    AnchorChanges {
-                                        target: maskCorner2
-                                        anchors{ top:parent.top; bottom:undefined; left:undefined; right:parent.right;}
-                                    }
-                                }
-                            ]
-                        } // audio mask
-                    }
-                    hideSource: true
-                    live: true
-                } //end of mask
-
-                supportsAtlasTextures: true
-
-                fragmentShader: "
-        varying highp vec2 qt_TexCoord0;
-        uniform highp float qt_Opacity;
-        uniform lowp sampler2D source;
-        uniform lowp sampler2D mask;
-        void main() {
-            gl_FragColor = texture2D(source, qt_TexCoord0.st) * (1.0 - (texture2D(mask, qt_TexCoord0.st).a)) * qt_Opacity;
-        }
-    "
-            } //end of sourceComponent
-        }
     }
     ////!
 
@@ -320,9 +222,11 @@ Item {
     Loader {
         id: badgeVisualsLoader
         anchors.fill: taskIconContainer
-        active: (badgesLoader.activateProgress > 0)
+        active: (badges.activateProgress > 0)
 
-        readonly property int infoBadgeWidth: active ? publishedInfoBadgeWidth : 0
+        //! info badge width relative to the icon width, in 1/16 steps in order to
+        //! not change the icon masks on every zoom frame
+        readonly property real infoBadgeRelativeWidth: active && width > 0 ? Math.ceil(16 * publishedInfoBadgeWidth / width) / 16 : 0
         property int publishedInfoBadgeWidth: 0
 
         sourceComponent: Item {
@@ -333,8 +237,8 @@ Item {
                 width: Math.max(parent.width, contentWidth)
                 height: parent.height
 
-                opacity: badgesLoader.activateProgress
-                visible: badgesLoader.showInfo || badgesLoader.showProgress
+                opacity: badges.activateProgress
+                visible: badges.showInfo || badges.showProgress
 
                 layer.enabled: taskItem.abilities.myView.itemShadow.isEnabled && graphicsSystem.isAccelerated
                 layer.effect: DropShadow {
@@ -350,8 +254,8 @@ Item {
             AudioStream{
                 id: audioStreamBadge
                 anchors.fill: parent
-                opacity: badgesLoader.activateProgress
-                visible: badgesLoader.showAudio
+                opacity: badges.activateProgress
+                visible: badges.showAudio
 
                 layer.enabled: taskItem.abilities.myView.itemShadow.isEnabled && graphicsSystem.isAccelerated
                 layer.effect: DropShadow {
@@ -411,7 +315,7 @@ Item {
         //! I don't know enabling cached=true helps, but it does.
         cached: true
 
-        source: badgesLoader.active ? badgesLoader : taskIconItem
+        source: taskIconItem
         visible: !isSeparator
 
         opacity:0
@@ -433,7 +337,7 @@ Item {
         //! I don't know enabling cached=true helps, but it does.
         cached: true
 
-        source: badgesLoader.active ? badgesLoader : taskIconItem
+        source: taskIconItem
         visible: !isSeparator
 
         opacity: taskItem.containsMouse && !clickedAnimation.running && !taskItem.abilities.indicators.info.providesHoveredAnimation ? 1 : 0
@@ -457,7 +361,7 @@ Item {
         //! I don't know enabling cached=true helps, but it does.
         cached: true
 
-        source: badgesLoader.active ? badgesLoader : taskIconItem
+        source: taskIconItem
 
         visible: clickedAnimation.running && !isSeparator
     }
@@ -497,7 +401,7 @@ Item {
     //! Animations
 
     Component.onDestruction: {
-        taskIcon.toBeDestroyed = true;
+        taskIconContainer.toBeDestroyed = true;
 
         if(removingAnimation.removingItem)
             removingAnimation.removingItem.destroy();
@@ -507,7 +411,7 @@ Item {
         if (smartLauncherEnabled && !smartLauncherItem) {
             var smartLauncher = Qt.createQmlObject(
                         " import org.kde.plasma.private.taskmanager 0.1 as TaskManagerApplet; TaskManagerApplet.SmartLauncherItem { }",
-                        taskIcon);
+                        taskIconContainer);
 
             smartLauncher.launcherUrl = Qt.binding(function() { return taskItem.launcherUrlWithIcon; });
 
@@ -545,7 +449,7 @@ Item {
 
     //////////// Transitions //////////////
 
-    readonly property string draggingNeedThicknessEvent: taskIcon + "_dragging"
+    readonly property string draggingNeedThicknessEvent: taskIconContainer + "_dragging"
 
     transitions: [
         Transition{
@@ -172,13 +172,13 @@ AbilityItem.BasicItem {
     indicator.panelOpacity: taskItem.abilities.myView.backgroundOpacity
     indicator.shadowColor: taskItem.abilities.myView.itemShadow.shadowSolidColor
 
-    indicator.progressVisible: taskIcon.progressVisible /*since 0.9.2*/
-    indicator.progress: taskIcon.progress /*since 0.9.2*/
+    indicator.progressVisible: taskIcon ? taskIcon.progressVisible : false /*since 0.9.2*/
+    indicator.progress: taskIcon ? taskIcon.progress : 0 /*since 0.9.2*/
 
     indicator.palette: taskItem.abilities.myView.palette
 
-    indicator.iconBackgroundColor: taskIcon.backgroundColor
-    indicator.iconGlowColor: taskIcon.glowColor
+    indicator.iconBackgroundColor: taskIcon ? taskIcon.backgroundColor : "transparent"
+    indicator.iconGlowColor: taskIcon ? taskIcon.glowColor : "transparent"
     //! Indicator Properties
 
     onModelLauncherUrlChanged: {
@@ -219,7 +219,7 @@ AbilityItem.BasicItem {
 
     ////// Audio streams //////
     property Item audioStreamOverlay
-    property var audioStreams: []
+    readonly property var audioStreams: taskAudioStreams.streams
     readonly property bool hasAudioStream: root.showAudioBadge && audioStreams.length > 0 && !isLauncher
     readonly property bool playingAudio: hasAudioStream && audioStreams.some(function (item) {
         return !item.corked
@@ -244,8 +244,37 @@ AbilityItem.BasicItem {
     }
 
     //! Content Item
-    contentItem: TaskIcon{
-        id:taskIcon
+    //! when the tasks list is virtualized, only the tasks that are in or near the visible
+    //! scroll window load their icon, the rest are placeholders of their known size
+    isVirtualized: scrollableList.virtualized
+                   && !isInVirtualWindow
+                   && !isDragged
+                   && !inBlockingAnimation
+                   && !inBouncingAnimation
+                   && !inFastRestoreAnimation
+                   && !inNewWindowAnimation
+
+    readonly property bool isInVirtualWindow: {
+        if (!scrollableList.virtualized) {
+            return true;
+        }
+
+        var start = root.vertical ? y : x;
+        var end = start + (root.vertical ? height : width);
+
+        return end >= scrollableList.virtualWindowStart && start <= scrollableList.virtualWindowEnd;
+    }
+
+    readonly property Item taskIcon: taskIconLoader.item
+
+    contentItem: Loader {
+        id: taskIconLoader
+        anchors.fill: parent
+        active: !taskItem.isVirtualized
+        //! icons of tasks that are scrolled into the view do not block scrolling
+        asynchronous: scrollableList.virtualized
+
+        sourceComponent: TaskIcon{}
     }
     //////
 
@@ -317,9 +346,6 @@ AbilityItem.BasicItem {
     // onItemIndexChanged: {
     //  }
 
-    onAppNameChanged: updateAudioStreams()
-    onPidChanged: updateAudioStreams()
-    onHasAudioStreamChanged: updateAudioStreams()
 
     onCanPublishGeometriesChanged: {
         if (canPublishGeometries) {
@@ -419,7 +445,8 @@ AbilityItem.BasicItem {
 
     function activateTask() {
         if( taskItem.isLauncher || root.disableAllWindowsFunctionality){
-            if (LatteCore.WindowSystem.compositingActive) {
+            //! launcher animation lives in TaskIcon, virtualized tasks or tasks whose icon is still loading launch directly
+            if (LatteCore.WindowSystem.compositingActive && taskItem.taskIcon) {
                 taskItem.launcherAnimationRequested();
             } else {
                 launcherAction();
@@ -707,56 +734,6 @@ AbilityItem.BasicItem {
     }
 
 
-    function updateAudioStreams() {
-        if (root.dragSource !== null) {
-            audioStreams = [];
-            return;
-        }
-
-        var pa = pulseAudio.item;
-        if (!pa) {
-            audioStreams = [];
-            return;
-        }
-
-        var streams = pa.streamsForPid(taskItem.pid);
-        if (streams.length) {
-            pa.registerPidMatch(taskItem.appName);
-        } else {
-            // We only want to fall back to appName matching if we never managed to map
-            // a PID to an audio stream window. Otherwise if you have two instances of
-            // an application, one playing and the other not, it will look up appName
-            // for the non-playing instance and erroneously show an indicator on both.
-            if (!pa.hasPidMatch(taskItem.appName)) {
-                var streams_result;
-                streams_result = pa.streamsForAppName(taskItem.appName);
-                if (streams_result.length===0 && launcherName !== "") {
-                    streams_result = pa.streamsForAppName(launcherName);
-                }
-                streams = streams_result;
-            }
-        }
-
-        // fix a binding loop concerning audiostreams, the audiostreams
-        // should be updated only when they have changed
-        var changed = false;
-
-        if (streams.length !== audioStreams.length) {
-            changed = true;
-        } else {
-            for(var i=0; i<streams.length; ++i) {
-                if (streams[i] !== audioStreams[i]) {
-                    changed = true;
-                    break;
-                }
-            }
-        }
-
-        if (changed) {
-            taskItem.audioStreams = streams;
-        }
-    }
-
     function onLauncherChanged(launcher) {
         if ((root.showWindowsOnlyFromLaunchers || root.disableAllWindowsFunctionality) && launcher === launcherUrl) {
             updateVisibilityBasedOnLaunchers()
@@ -814,10 +791,16 @@ AbilityItem.BasicItem {
         }
     }
 
-    Connections {
-        target: pulseAudio.item
-        ignoreUnknownSignals: true // Plasma-PA might not be available
-        onStreamsChanged: taskItem.updateAudioStreams()
+    LatteTasks.TaskAudioStreams {
+        id: taskAudioStreams
+        index: pulseAudio.item ? pulseAudio.item.streamsIndex : null // Plasma-PA might not be available
+        //trying to fix #440, showing the audio icon indicator to irrelevant tasks
+        //after dragging an existent task with audio
+        enabled: root.dragSource === null
+        isWindow: taskItem.isWindow
+        pid: taskItem.pid
+        appName: taskItem.appName
+        launcherName: taskItem.launcherName
     }
 
     //fix bug #478, when changing form factor sometimes the tasks are not positioned
@@ -831,11 +814,6 @@ AbilityItem.BasicItem {
 
     Connections {
         target: root
-        //trying to fix #440, showing the audio icon indicator to irrelevant tasks
-        //after dragging an existent task with audio
-        onDragSourceChanged: taskItem.updateAudioStreams()
-        onShowAudioBadgeChanged: taskItem.updateAudioStreams()
-
         onDisableAllWindowsFunctionalityChanged: {
             if (!root.inEditMode) {
                 return;
@@ -911,7 +889,6 @@ AbilityItem.BasicItem {
         }
 
         showWindowAnimation.showWindow();
-        updateAudioStreams();
     }
 
     Component.onDestruction: {
@@ -261,7 +261,11 @@ MouseArea {
                 scrollableList.decreasePos();
             } else {
                 if (isLauncher || root.disableAllWindowsFunctionality) {
-                    taskItem.launcherAnimationRequested();
+                    if (taskItem.taskIcon) {
+                        taskItem.launcherAnimationRequested();
+                    } else {
+                        taskItem.launcherAction();
+                    }
                 } else if (isGroupParent) {
                     subWindows.activateNextTask();
                 } else {
@@ -31,7 +31,7 @@ Item{
     id:removingAnimation
 
     function init(){
-        var relavantPoint = root.mapFromItem(taskIcon,0,0);
+        var relavantPoint = root.mapFromItem(taskIconContainer,0,0);
 
         var removingItem = removeTaskComponent.createObject(root);
         removingItem.x = relavantPoint.x;
@@ -60,8 +60,8 @@ Item{
         id: removeTaskComponent
         Item{
             id: removeTask
-            width: taskIcon.width
-            height: taskIcon.height
+            width: taskIconContainer.width
+            height: taskIconContainer.height
 
             visible: false
 
@@ -59,6 +59,15 @@ Flickable{
     readonly property int scrollStep: appletAbilities.metrics.totals.length * 3.5
     readonly property int currentPos: !root.vertical ? contentX : contentY
 
+    //! Virtualized tasks list: when tasks exceed the visible area, only the tasks
+    //! in or near the visible scroll window load their heavy contents
+    readonly property bool virtualized: contentsExceed
+    readonly property int virtualWindowMargin: scrollStep
+    //! visible scroll window in tasks list coordinates
+    readonly property real virtualWindowStart: currentPos - virtualWindowMargin - tasksListOffset
+    readonly property real virtualWindowEnd: currentPos + (!root.vertical ? width : height) + virtualWindowMargin - tasksListOffset
+    readonly property real tasksListOffset: !root.vertical ? listViewBase.x + icList.x + icList.contentItem.x : listViewBase.y + icList.y + icList.contentItem.y
+
     readonly property int autoScrollTriggerLength: appletAbilities.metrics.iconSize + appletAbilities.metrics.totals.lengthEdge
 
     readonly property int alignment: {
@@ -0,0 +1,235 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "audiostreamsindex.h"
+
+// local
+#include "taskaudiostreams.h"
+
+// C++
+#include <algorithm>
+
+namespace Latte {
+namespace Tasks {
+
+AudioStreamsIndex::AudioStreamsIndex(QObject *parent)
+    : QObject(parent)
+{
+    m_subscribersTimer.setInterval(0);
+    m_subscribersTimer.setSingleShot(true);
+    connect(&m_subscribersTimer, &QTimer::timeout, this, &AudioStreamsIndex::updateSubscribers);
+}
+
+AudioStreamsIndex::~AudioStreamsIndex()
+{
+    const auto subscribers = m_subscriptions.keys();
+
+    for (auto *subscriber : subscribers) {
+        subscriber->indexDestroyed();
+    }
+}
+
+void AudioStreamsIndex::setStream(QObject *stream, const int pid, const QString &appName)
+{
+    if (!stream) {
+        return;
+    }
+
+    const QString key = appName.toLower();
+
+    if (m_streams.contains(stream)) {
+        StreamData &data = m_streams[stream];
+
+        if (data.pid == pid && data.appName == key) {
+            return;
+        }
+
+        m_streamsByPid.remove(data.pid, stream);
+        m_streamsByAppName.remove(data.appName, stream);
+        notifyPid(data.pid);
+        notifyAppName(data.appName);
+
+        data.pid = pid;
+        data.appName = key;
+    } else {
+        StreamData data;
+        data.pid = pid;
+        data.appName = key;
+        data.order = m_nextStreamOrder++;
+        m_streams[stream] = data;
+
+        connect(stream, &QObject::destroyed, this, [this, stream]() {
+            removeStream(stream);
+        });
+    }
+
+    m_streamsByPid.insert(pid, stream);
+    m_streamsByAppName.insert(key, stream);
+    notifyPid(pid);
+    notifyAppName(key);
+}
+
+void AudioStreamsIndex::removeStream(QObject *stream)
+{
+    if (!m_streams.contains(stream)) {
+        return;
+    }
+
+    const StreamData data = m_streams.take(stream);
+
+    disconnect(stream, &QObject::destroyed, this, nullptr);
+    m_streamsByPid.remove(data.pid, stream);
+    m_streamsByAppName.remove(data.appName, stream);
+
+    notifyPid(data.pid);
+    notifyAppName(data.appName);
+}
+
+QList<QObject *> AudioStreamsIndex::sortedStreams(QList<QObject *> streams) const
+{
+    std::sort(streams.begin(), streams.end(), [&](QObject *a, QObject *b) {
+        return m_streams[a].order < m_streams[b].order;
+    });
+
+    return streams;
+}
+
+QList<QObject *> AudioStreamsIndex::streamsForPid(const int pid) const
+{
+    return sortedStreams(m_streamsByPid.values(pid));
+}
+
+QList<QObject *> AudioStreamsIndex::streamsForAppName(const QString &appName) const
+{
+    return sortedStreams(m_streamsByAppName.values(appName.toLower()));
+}
+
+void AudioStreamsIndex::registerPidMatch(const QString &appName)
+{
+    if (m_pidMatches.contains(appName)) {
+        return;
+    }
+
+    m_pidMatches.insert(appName);
+
+    //! In case this match is new, notify that streams might have changed.
+    //! This way we also catch the case when the non-playing instance
+    //! shows up first.
+    notifyAppName(appName.toLower());
+}
+
+bool AudioStreamsIndex::hasPidMatch(const QString &appName) const
+{
+    return m_pidMatches.contains(appName);
+}
+
+void AudioStreamsIndex::addAppWindow(const QString &appName)
+{
+    m_appWindows[appName]++;
+}
+
+void AudioStreamsIndex::removeAppWindow(const QString &appName)
+{
+    auto windows = m_appWindows.find(appName);
+
+    if (windows == m_appWindows.end()) {
+        return;
+    }
+
+    if (--windows.value() <= 0) {
+        //! all instances of the application were closed
+        m_appWindows.erase(windows);
+
+        if (m_pidMatches.remove(appName)) {
+            notifyAppName(appName.toLower());
+        }
+    }
+}
+
+void AudioStreamsIndex::subscribe(TaskAudioStreams *subscriber, const int pid, const QStringList &appNames)
+{
+    unsubscribe(subscriber);
+
+    SubscriptionData data;
+    data.pid = pid;
+    m_pidSubscribers.insert(pid, subscriber);
+
+    for (const auto &appName : appNames) {
+        const QString key = appName.toLower();
+
+        if (!key.isEmpty() && !data.appNames.contains(key)) {
+            data.appNames << key;
+            m_appNameSubscribers.insert(key, subscriber);
+        }
+    }
+
+    m_subscriptions[subscriber] = data;
+}
+
+void AudioStreamsIndex::unsubscribe(TaskAudioStreams *subscriber)
+{
+    auto subscription = m_subscriptions.find(subscriber);
+
+    if (subscription != m_subscriptions.end()) {
+        m_pidSubscribers.remove(subscription.value().pid, subscriber);
+
+        for (const auto &appName : subscription.value().appNames) {
+            m_appNameSubscribers.remove(appName, subscriber);
+        }
+
+        m_subscriptions.erase(subscription);
+    }
+
+    m_pendingSubscribers.remove(subscriber);
+}
+
+void AudioStreamsIndex::notifyPid(const int pid)
+{
+    for (auto it = m_pidSubscribers.constFind(pid); it != m_pidSubscribers.constEnd() && it.key() == pid; ++it) {
+        m_pendingSubscribers.insert(it.value());
+    }
+
+    if (!m_pendingSubscribers.isEmpty()) {
+        m_subscribersTimer.start();
+    }
+}
+
+void AudioStreamsIndex::notifyAppName(const QString &appName)
+{
+    for (auto it = m_appNameSubscribers.constFind(appName); it != m_appNameSubscribers.constEnd() && it.key() == appName; ++it) {
+        m_pendingSubscribers.insert(it.value());
+    }
+
+    if (!m_pendingSubscribers.isEmpty()) {
+        m_subscribersTimer.start();
+    }
+}
+
+void AudioStreamsIndex::updateSubscribers()
+{
+    const auto subscribers = m_pendingSubscribers;
+    m_pendingSubscribers.clear();
+
+    for (auto *subscriber : subscribers) {
+        subscriber->updateStreams();
+    }
+}
+
+}
+}
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTETASKSAUDIOSTREAMSINDEX_H
+#define LATTETASKSAUDIOSTREAMSINDEX_H
+
+// Qt
+#include <QHash>
+#include <QMultiHash>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QTimer>
+
+namespace Latte {
+namespace Tasks {
+class TaskAudioStreams;
+}
+}
+
+namespace Latte {
+namespace Tasks {
+
+//! Index of the PulseAudio streams by pid and application name. Task audio
+//! streams subscribe to the keys they are interested in and only they are
+//! updated when streams of these keys change.
+class AudioStreamsIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    AudioStreamsIndex(QObject *parent = nullptr);
+    ~AudioStreamsIndex() override;
+
+    //! adds a stream or updates its keys if it is already indexed
+    Q_INVOKABLE void setStream(QObject *stream, const int pid, const QString &appName);
+    Q_INVOKABLE void removeStream(QObject *stream);
+
+    QList<QObject *> streamsForPid(const int pid) const;
+    QList<QObject *> streamsForAppName(const QString &appName) const;
+
+    //! applications for which a pid was matched at least once to an audio stream,
+    //! they are forgotten when their last window is closed
+    void registerPidMatch(const QString &appName);
+    bool hasPidMatch(const QString &appName) const;
+
+    void addAppWindow(const QString &appName);
+    void removeAppWindow(const QString &appName);
+
+    void subscribe(TaskAudioStreams *subscriber, const int pid, const QStringList &appNames);
+    void unsubscribe(TaskAudioStreams *subscriber);
+
+private slots:
+    void updateSubscribers();
+
+private:
+    struct StreamData {
+        int pid{0};
+        QString appName;
+        quint64 order{0};
+    };
+
+    //! keys a subscriber is subscribed to, only these keys are visited when it unsubscribes
+    struct SubscriptionData {
+        int pid{0};
+        QStringList appNames;
+    };
+
+    void notifyPid(const int pid);
+    void notifyAppName(const QString &appName);
+
+    QList<QObject *> sortedStreams(QList<QObject *> streams) const;
+
+private:
+    //! streams are returned in the order they were added
+    quint64 m_nextStreamOrder{0};
+
+    QHash<QObject *, StreamData> m_streams;
+    QMultiHash<int, QObject *> m_streamsByPid;
+    QMultiHash<QString, QObject *> m_streamsByAppName;
+
+    QSet<QString> m_pidMatches;
+    QHash<QString, int> m_appWindows;
+
+    QMultiHash<int, TaskAudioStreams *> m_pidSubscribers;
+    QMultiHash<QString, TaskAudioStreams *> m_appNameSubscribers;
+    QHash<TaskAudioStreams *, SubscriptionData> m_subscriptions;
+
+    //! subscribers are updated once per event loop pass
+    QSet<TaskAudioStreams *> m_pendingSubscribers;
+    QTimer m_subscribersTimer;
+};
+
+}
+}
+
+#endif
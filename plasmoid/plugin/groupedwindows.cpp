@@ -0,0 +1,389 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "groupedwindows.h"
+
+namespace Latte {
+namespace Tasks {
+
+GroupedWindows::GroupedWindows(QObject *parent)
+    : QObject(parent)
+{
+}
+
+GroupedWindows::~GroupedWindows()
+{
+}
+
+QAbstractItemModel *GroupedWindows::model() const
+{
+    return m_model;
+}
+
+void GroupedWindows::setModel(QAbstractItemModel *model)
+{
+    if (m_model == model) {
+        return;
+    }
+
+    if (m_model) {
+        disconnect(m_model, nullptr, this, nullptr);
+    }
+
+    m_model = model;
+
+    if (m_model) {
+        connect(m_model, &QAbstractItemModel::dataChanged, this, &GroupedWindows::onDataChanged);
+        connect(m_model, &QAbstractItemModel::rowsInserted, this, &GroupedWindows::onRowsInserted);
+        connect(m_model, &QAbstractItemModel::rowsRemoved, this, &GroupedWindows::onRowsRemoved);
+        connect(m_model, &QAbstractItemModel::rowsMoved, this, &GroupedWindows::reload);
+        connect(m_model, &QAbstractItemModel::layoutChanged, this, &GroupedWindows::reload);
+        connect(m_model, &QAbstractItemModel::modelReset, this, &GroupedWindows::reload);
+    }
+
+    m_rootIndex = QPersistentModelIndex();
+    updateRoles();
+    reload();
+
+    emit modelChanged();
+}
+
+QModelIndex GroupedWindows::rootIndex() const
+{
+    return m_rootIndex;
+}
+
+void GroupedWindows::setRootIndex(const QModelIndex &index)
+{
+    if (m_rootIndex == index) {
+        return;
+    }
+
+    m_rootIndex = index;
+    reload();
+
+    emit rootIndexChanged();
+}
+
+int GroupedWindows::count() const
+{
+    return m_count;
+}
+
+int GroupedWindows::minimizedCount() const
+{
+    return m_minimizedCount;
+}
+
+bool GroupedWindows::hasActive() const
+{
+    return m_activeCount > 0;
+}
+
+bool GroupedWindows::hasMinimized() const
+{
+    return m_minimizedCount > 0;
+}
+
+bool GroupedWindows::hasShown() const
+{
+    return m_shownCount > 0;
+}
+
+QVariant GroupedWindows::lastActiveWindow() const
+{
+    return m_lastActiveWindow;
+}
+
+void GroupedWindows::setLastActiveWindow(const QVariant &windowId)
+{
+    if (m_lastActiveWindow == windowId) {
+        return;
+    }
+
+    m_lastActiveWindow = windowId;
+    emit lastActiveWindowChanged();
+}
+
+void GroupedWindows::updateRoles()
+{
+    m_isActiveRole = -1;
+    m_isMinimizedRole = -1;
+    m_isWindowRole = -1;
+    m_winIdListRole = -1;
+
+    if (!m_model) {
+        return;
+    }
+
+    const QHash<int, QByteArray> roles = m_model->roleNames();
+
+    for (auto it = roles.constBegin(); it != roles.constEnd(); ++it) {
+        if (it.value() == QByteArrayLiteral("IsActive")) {
+            m_isActiveRole = it.key();
+        } else if (it.value() == QByteArrayLiteral("IsMinimized")) {
+            m_isMinimizedRole = it.key();
+        } else if (it.value() == QByteArrayLiteral("IsWindow")) {
+            m_isWindowRole = it.key();
+        } else if (it.value() == QByteArrayLiteral("WinIdList")) {
+            m_winIdListRole = it.key();
+        } else if (it.value() == QByteArrayLiteral("LegacyWinIdList") && m_winIdListRole == -1) {
+            //! plasma < 5.15
+            m_winIdListRole = it.key();
+        }
+    }
+}
+
+bool GroupedWindows::isGroupParent(const QModelIndex &parent) const
+{
+    return m_rootIndex.isValid() && parent.isValid() && parent == m_rootIndex;
+}
+
+GroupedWindows::WindowData GroupedWindows::windowData(const int row) const
+{
+    WindowData data;
+    const QModelIndex index = m_model->index(row, 0, m_rootIndex);
+
+    data.isActive = index.data(m_isActiveRole).toBool();
+    data.isMinimized = index.data(m_isMinimizedRole).toBool();
+    data.isWindow = index.data(m_isWindowRole).toBool();
+
+    const QVariantList winIds = index.data(m_winIdListRole).toList();
+    data.windowId = winIds.isEmpty() ? QVariant() : winIds.first();
+
+    return data;
+}
+
+void GroupedWindows::reload()
+{
+    m_windows.clear();
+
+    if (m_model && m_rootIndex.isValid()) {
+        const int rows = m_model->rowCount(m_rootIndex);
+        m_windows.reserve(rows);
+
+        for (int i = 0; i < rows; ++i) {
+            m_windows << windowData(i);
+        }
+    }
+
+    updateStates();
+}
+
+void GroupedWindows::onDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (!isGroupParent(topLeft.parent())) {
+        return;
+    }
+
+    if (!roles.isEmpty()
+            && !roles.contains(m_isActiveRole)
+            && !roles.contains(m_isMinimizedRole)
+            && !roles.contains(m_isWindowRole)
+            && !roles.contains(m_winIdListRole)) {
+        return;
+    }
+
+    const int last = qMin(bottomRight.row(), m_windows.count() - 1);
+
+    for (int i = qMax(0, topLeft.row()); i <= last; ++i) {
+        const WindowData data = windowData(i);
+
+        if (data.isActive && !m_windows[i].isActive) {
+            setLastActiveWindow(data.windowId);
+        }
+
+        m_windows[i] = data;
+    }
+
+    updateStates();
+}
+
+void GroupedWindows::onRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (!isGroupParent(parent)) {
+        return;
+    }
+
+    for (int i = first; i <= last; ++i) {
+        const WindowData data = windowData(i);
+
+        if (data.isActive) {
+            setLastActiveWindow(data.windowId);
+        }
+
+        m_windows.insert(qMin(i, m_windows.count()), data);
+    }
+
+    updateStates();
+}
+
+void GroupedWindows::onRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (!isGroupParent(parent)) {
+        return;
+    }
+
+    if (first < m_windows.count()) {
+        m_windows.remove(first, qMin(last, m_windows.count() - 1) - first + 1);
+    }
+
+    updateStates();
+}
+
+void GroupedWindows::updateStates()
+{
+    const int previousCount = m_count;
+    const int previousMinimized = m_minimizedCount;
+    const bool hadActive = hasActive();
+    const bool hadShown = hasShown();
+
+    m_count = m_windows.count();
+    m_activeCount = 0;
+    m_minimizedCount = 0;
+    m_shownCount = 0;
+
+    for (const auto &window : m_windows) {
+        if (window.isActive) {
+            ++m_activeCount;
+        }
+
+        if (window.isMinimized) {
+            ++m_minimizedCount;
+        } else if (window.isWindow) {
+            ++m_shownCount;
+        }
+    }
+
+    if (previousCount != m_count) {
+        emit countChanged();
+    }
+
+    if (previousMinimized != m_minimizedCount) {
+        emit minimizedCountChanged();
+    }
+
+    if (hadActive != hasActive()) {
+        emit hasActiveChanged();
+    }
+
+    if (hadShown != hasShown()) {
+        emit hasShownChanged();
+    }
+}
+
+QStringList GroupedWindows::windowsTitles() const
+{
+    QStringList titles;
+
+    if (!m_model || !m_rootIndex.isValid()) {
+        return titles;
+    }
+
+    for (int i = 0; i < m_model->rowCount(m_rootIndex); ++i) {
+        titles << m_model->index(i, 0, m_rootIndex).data(Qt::DisplayRole).toString();
+    }
+
+    return titles;
+}
+
+int GroupedWindows::nextWindowRow() const
+{
+    int next{-1};
+
+    for (int i = 0; i < m_windows.count(); ++i) {
+        if (m_windows[i].isActive) {
+            next = i + 1;
+            break;
+        }
+    }
+
+    //! the active window is the last one
+    if (next >= m_windows.count()) {
+        next = 0;
+    }
+
+    if (next == -1 && m_lastActiveWindow.isValid()) {
+        for (int i = 0; i < m_windows.count(); ++i) {
+            if (m_windows[i].windowId == m_lastActiveWindow) {
+                next = i;
+                break;
+            }
+        }
+    }
+
+    return next == -1 ? 0 : next;
+}
+
+int GroupedWindows::previousWindowRow() const
+{
+    //! -2 indicates that nothing was found
+    int previous{-2};
+
+    for (int i = m_windows.count() - 1; i >= 0; --i) {
+        if (m_windows[i].isActive) {
+            previous = i - 1;
+            break;
+        }
+    }
+
+    //! the active window is the first one
+    if (previous == -1) {
+        previous = m_windows.count() - 1;
+    }
+
+    if (previous == -2 && m_lastActiveWindow.isValid()) {
+        for (int i = m_windows.count() - 1; i >= 0; --i) {
+            if (m_windows[i].windowId == m_lastActiveWindow) {
+                previous = i;
+                break;
+            }
+        }
+    }
+
+    return previous == -2 ? 0 : previous;
+}
+
+int GroupedWindows::windowRowToMinimize() const
+{
+    for (int i = m_windows.count() - 1; i >= 0; --i) {
+        if (m_windows[i].isActive) {
+            return i;
+        }
+    }
+
+    if (m_lastActiveWindow.isValid()) {
+        for (int i = m_windows.count() - 1; i >= 0; --i) {
+            if (m_windows[i].windowId == m_lastActiveWindow && !m_windows[i].isMinimized) {
+                return i;
+            }
+        }
+    }
+
+    for (int i = m_windows.count() - 1; i >= 0; --i) {
+        if (!m_windows[i].isMinimized) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+}
+}
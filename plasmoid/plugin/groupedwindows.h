@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTETASKSGROUPEDWINDOWS_H
+#define LATTETASKSGROUPEDWINDOWS_H
+
+// Qt
+#include <QAbstractItemModel>
+#include <QObject>
+#include <QPersistentModelIndex>
+#include <QPointer>
+#include <QVariant>
+#include <QVector>
+
+namespace Latte {
+namespace Tasks {
+
+//! Tracks the windows of a tasks group, the children of rootIndex in the
+//! tasks model, and provides their aggregated states. States are updated
+//! incrementally from the model signals that concern the group children only.
+class GroupedWindows : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QAbstractItemModel *model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(QModelIndex rootIndex READ rootIndex WRITE setRootIndex NOTIFY rootIndexChanged)
+
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(int minimizedCount READ minimizedCount NOTIFY minimizedCountChanged)
+
+    Q_PROPERTY(bool hasActive READ hasActive NOTIFY hasActiveChanged)
+    Q_PROPERTY(bool hasMinimized READ hasMinimized NOTIFY minimizedCountChanged)
+    Q_PROPERTY(bool hasShown READ hasShown NOTIFY hasShownChanged)
+
+    //! the first window id of the window that was activated last in the group
+    Q_PROPERTY(QVariant lastActiveWindow READ lastActiveWindow NOTIFY lastActiveWindowChanged)
+
+public:
+    GroupedWindows(QObject *parent = nullptr);
+    ~GroupedWindows() override;
+
+    QAbstractItemModel *model() const;
+    void setModel(QAbstractItemModel *model);
+
+    QModelIndex rootIndex() const;
+    void setRootIndex(const QModelIndex &index);
+
+    int count() const;
+    int minimizedCount() const;
+
+    bool hasActive() const;
+    bool hasMinimized() const;
+    bool hasShown() const;
+
+    QVariant lastActiveWindow() const;
+
+    Q_INVOKABLE QStringList windowsTitles() const;
+
+    //! rows of the group windows that must be used when cycling through them
+    Q_INVOKABLE int nextWindowRow() const;
+    Q_INVOKABLE int previousWindowRow() const;
+    Q_INVOKABLE int windowRowToMinimize() const;
+
+signals:
+    void countChanged();
+    void hasActiveChanged();
+    void hasShownChanged();
+    void lastActiveWindowChanged();
+    void minimizedCountChanged();
+    void modelChanged();
+    void rootIndexChanged();
+
+private slots:
+    void onDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+    void onRowsInserted(const QModelIndex &parent, int first, int last);
+    void onRowsRemoved(const QModelIndex &parent, int first, int last);
+    void reload();
+
+private:
+    struct WindowData {
+        bool isActive{false};
+        bool isMinimized{false};
+        bool isWindow{false};
+        QVariant windowId;
+    };
+
+    void updateRoles();
+    void updateStates();
+    void setLastActiveWindow(const QVariant &windowId);
+
+    bool isGroupParent(const QModelIndex &parent) const;
+    WindowData windowData(const int row) const;
+
+private:
+    int m_count{0};
+    int m_activeCount{0};
+    int m_minimizedCount{0};
+    int m_shownCount{0};
+
+    //! tasks model roles, they are resolved by name in order to
+    //! support all plasma versions
+    int m_isActiveRole{-1};
+    int m_isMinimizedRole{-1};
+    int m_isWindowRole{-1};
+    int m_winIdListRole{-1};
+
+    QVariant m_lastActiveWindow;
+
+    QPointer<QAbstractItemModel> m_model;
+    QPersistentModelIndex m_rootIndex;
+
+    QVector<WindowData> m_windows;
+};
+
+}
+}
+
+#endif
@@ -20,7 +20,13 @@
 #include "lattetasksplugin.h"
 
 // local
+#include "audiostreamsindex.h"
 #include "dialog.h"
+#include "groupedwindows.h"
+#include "launcherstracker.h"
+#include "previewspool.h"
+#include "previewthumbnail.h"
+#include "taskaudiostreams.h"
 #include "types.h"
 
 // Qt
@@ -32,5 +38,11 @@ void LatteTasksPlugin::registerTypes(const char *uri)
     Q_ASSERT(uri == QLatin1String("org.kde.latte.private.tasks"));
     qmlRegisterUncreatableType<Latte::Tasks::Types>(uri, 0, 1, "Types", "Latte Tasks Types uncreatable");
     qmlRegisterType<Latte::Quick::Dialog>(uri, 0, 1, "Dialog");
+    qmlRegisterType<Latte::Tasks::GroupedWindows>(uri, 0, 1, "GroupedWindows");
+    qmlRegisterType<Latte::Tasks::LaunchersTracker>(uri, 0, 1, "LaunchersTracker");
+    qmlRegisterType<Latte::Tasks::AudioStreamsIndex>(uri, 0, 1, "AudioStreamsIndex");
+    qmlRegisterType<Latte::Tasks::TaskAudioStreams>(uri, 0, 1, "TaskAudioStreams");
+    qmlRegisterType<Latte::Tasks::PreviewsPool>(uri, 0, 1, "PreviewsPool");
+    qmlRegisterType<Latte::Tasks::PreviewThumbnail>(uri, 0, 1, "PreviewThumbnail");
 }
 
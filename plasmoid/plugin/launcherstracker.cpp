@@ -0,0 +1,291 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "launcherstracker.h"
+
+// C++
+#include <limits>
+
+namespace Latte {
+namespace Tasks {
+
+LaunchersTracker::LaunchersTracker(QObject *parent)
+    : QObject(parent)
+{
+    m_clock.start();
+
+    m_expiryTimer.setSingleShot(true);
+    connect(&m_expiryTimer, &QTimer::timeout, this, &LaunchersTracker::removeExpiredRecords);
+}
+
+LaunchersTracker::~LaunchersTracker()
+{
+}
+
+int LaunchersTracker::launchersToBeRemovedCount() const
+{
+    return m_launchersToBeRemoved.count();
+}
+
+bool LaunchersTracker::matches(const QString &recorded, const QString &launcher)
+{
+    return !launcher.isEmpty()
+            && !recorded.isEmpty()
+            && (launcher.contains(recorded) || recorded.contains(launcher));
+}
+
+LaunchersTracker::LaunchersRecords::const_iterator LaunchersTracker::findMatching(const LaunchersRecords &records, const QString &launcher)
+{
+    auto exact = records.constFind(launcher);
+
+    if (exact != records.constEnd() || launcher.isEmpty()) {
+        return exact;
+    }
+
+    auto oldest = records.constEnd();
+
+    for (auto it = records.constBegin(); it != records.constEnd(); ++it) {
+        if (matches(it.key(), launcher) && (oldest == records.constEnd() || it.value() < oldest.value())) {
+            oldest = it;
+        }
+    }
+
+    return oldest;
+}
+
+void LaunchersTracker::scheduleExpiry()
+{
+    if (!m_expiryTimer.isActive()) {
+        m_expiryTimer.start(RECORDLIFETIME);
+    }
+}
+
+//! WAITING LAUNCHERS
+void LaunchersTracker::addWaitingLauncher(const QString &launcher)
+{
+    if (waitingLauncherExists(launcher)) {
+        return;
+    }
+
+    m_waitingLaunchers[launcher] = m_clock.elapsed();
+    scheduleExpiry();
+}
+
+void LaunchersTracker::removeWaitingLauncher(const QString &launcher)
+{
+    auto record = findMatching(m_waitingLaunchers, launcher);
+
+    if (record == m_waitingLaunchers.constEnd()) {
+        return;
+    }
+
+    m_waitingLaunchers.remove(record.key());
+    emit waitingLauncherRemoved(launcher);
+}
+
+bool LaunchersTracker::waitingLauncherExists(const QString &launcher) const
+{
+    return findMatching(m_waitingLaunchers, launcher) != m_waitingLaunchers.constEnd();
+}
+
+int LaunchersTracker::waitingLaunchersLength() const
+{
+    return m_waitingLaunchers.count();
+}
+
+//! LAUNCHERS TO BE ADDED
+void LaunchersTracker::addToBeAddedLauncher(const QString &launcher)
+{
+    if (toBeAddedLauncherExists(launcher)) {
+        return;
+    }
+
+    m_launchersToBeAdded[launcher] = m_clock.elapsed();
+    scheduleExpiry();
+}
+
+void LaunchersTracker::removeToBeAddedLauncher(const QString &launcher)
+{
+    auto record = findMatching(m_launchersToBeAdded, launcher);
+
+    if (record != m_launchersToBeAdded.constEnd()) {
+        m_launchersToBeAdded.remove(record.key());
+    }
+}
+
+bool LaunchersTracker::toBeAddedLauncherExists(const QString &launcher) const
+{
+    return findMatching(m_launchersToBeAdded, launcher) != m_launchersToBeAdded.constEnd();
+}
+
+//! LAUNCHERS TO BE REMOVED
+void LaunchersTracker::addToBeRemovedLauncher(const QString &launcher)
+{
+    if (m_launchersToBeRemoved.contains(launcher)) {
+        return;
+    }
+
+    m_launchersToBeRemoved[launcher] = m_clock.elapsed();
+    scheduleExpiry();
+
+    emit launchersToBeRemovedCountChanged();
+}
+
+void LaunchersTracker::removeToBeRemovedLauncher(const QString &launcher)
+{
+    if (m_launchersToBeRemoved.remove(launcher) > 0) {
+        emit launchersToBeRemovedCountChanged();
+    }
+}
+
+bool LaunchersTracker::isLauncherToBeRemoved(const QString &launcher) const
+{
+    return m_launchersToBeRemoved.contains(launcher);
+}
+
+//! IMMEDIATE LAUNCHERS
+void LaunchersTracker::addImmediateLauncher(const QString &launcher)
+{
+    if (m_immediateLaunchers.contains(launcher)) {
+        return;
+    }
+
+    m_immediateLaunchers[launcher] = m_clock.elapsed();
+    scheduleExpiry();
+}
+
+void LaunchersTracker::removeImmediateLauncher(const QString &launcher)
+{
+    m_immediateLaunchers.remove(launcher);
+}
+
+bool LaunchersTracker::immediateLauncherExists(const QString &launcher) const
+{
+    return m_immediateLaunchers.contains(launcher);
+}
+
+//! LAUNCHERS TO BE MOVED
+void LaunchersTracker::addLauncherToBeMoved(const QString &launcher, const int pos)
+{
+    if (m_launchersToBeMoved.contains(launcher)) {
+        return;
+    }
+
+    MovedLauncherData data;
+    data.pos = qMax(0, pos);
+    data.added = m_clock.elapsed();
+
+    m_launchersToBeMoved[launcher] = data;
+    scheduleExpiry();
+}
+
+void LaunchersTracker::removeLauncherToBeMoved(const QString &launcher)
+{
+    m_launchersToBeMoved.remove(launcher);
+}
+
+bool LaunchersTracker::isLauncherToBeMoved(const QString &launcher) const
+{
+    return m_launchersToBeMoved.contains(launcher);
+}
+
+int LaunchersTracker::posOfLauncherToBeMoved(const QString &launcher) const
+{
+    auto record = m_launchersToBeMoved.constFind(launcher);
+
+    return record != m_launchersToBeMoved.constEnd() ? record.value().pos : -1;
+}
+
+//! FROZEN TASKS
+void LaunchersTracker::setFrozenTask(const QString &identifier, const qreal zoom)
+{
+    FrozenTaskData data;
+    data.zoom = zoom;
+    data.added = m_clock.elapsed();
+
+    m_frozenTasks[identifier] = data;
+    scheduleExpiry();
+}
+
+void LaunchersTracker::removeFrozenTask(const QString &identifier)
+{
+    m_frozenTasks.remove(identifier);
+}
+
+qreal LaunchersTracker::frozenTaskZoom(const QString &identifier) const
+{
+    auto record = m_frozenTasks.constFind(identifier);
+
+    return record != m_frozenTasks.constEnd() ? record.value().zoom : -1;
+}
+
+void LaunchersTracker::removeExpiredRecords()
+{
+    const qint64 now = m_clock.elapsed();
+    const qint64 expired = now - RECORDLIFETIME;
+    //! next expiry is scheduled for the oldest record that remains
+    qint64 oldest = std::numeric_limits<qint64>::max();
+
+    auto expireRecords = [&](LaunchersRecords &records) {
+        for (auto it = records.begin(); it != records.end();) {
+            if (it.value() <= expired) {
+                it = records.erase(it);
+            } else {
+                oldest = qMin(oldest, it.value());
+                ++it;
+            }
+        }
+    };
+
+    const int toBeRemovedCount = m_launchersToBeRemoved.count();
+
+    expireRecords(m_waitingLaunchers);
+    expireRecords(m_launchersToBeAdded);
+    expireRecords(m_launchersToBeRemoved);
+    expireRecords(m_immediateLaunchers);
+
+    for (auto it = m_launchersToBeMoved.begin(); it != m_launchersToBeMoved.end();) {
+        if (it.value().added <= expired) {
+            it = m_launchersToBeMoved.erase(it);
+        } else {
+            oldest = qMin(oldest, it.value().added);
+            ++it;
+        }
+    }
+
+    for (auto it = m_frozenTasks.begin(); it != m_frozenTasks.end();) {
+        if (it.value().added <= expired) {
+            it = m_frozenTasks.erase(it);
+        } else {
+            oldest = qMin(oldest, it.value().added);
+            ++it;
+        }
+    }
+
+    if (toBeRemovedCount != m_launchersToBeRemoved.count()) {
+        emit launchersToBeRemovedCountChanged();
+    }
+
+    if (oldest != std::numeric_limits<qint64>::max()) {
+        m_expiryTimer.start(static_cast<int>(qMax<qint64>(0, oldest + RECORDLIFETIME - now)));
+    }
+}
+
+}
+}
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTETASKSLAUNCHERSTRACKER_H
+#define LATTETASKSLAUNCHERSTRACKER_H
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+
+namespace Latte {
+namespace Tasks {
+
+//! Bookkeeping of launchers and tasks that are in the middle of a state change
+//! (launcher<->startup<->window), adding, removal or moving. Records are only needed
+//! for a few seconds from animations, they expire RECORDLIFETIME after their addition
+//! in case nobody used them.
+class LaunchersTracker : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int launchersToBeRemovedCount READ launchersToBeRemovedCount NOTIFY launchersToBeRemovedCountChanged)
+
+public:
+    LaunchersTracker(QObject *parent = nullptr);
+    ~LaunchersTracker() override;
+
+    int launchersToBeRemovedCount() const;
+
+    //! Launchers that are playing an ADD or REMOVAL animation
+    //! and their Startups/Windows should be aware of
+    Q_INVOKABLE void addWaitingLauncher(const QString &launcher);
+    Q_INVOKABLE void removeWaitingLauncher(const QString &launcher);
+    Q_INVOKABLE bool waitingLauncherExists(const QString &launcher) const;
+    Q_INVOKABLE int waitingLaunchersLength() const;
+
+    //! Launchers that are added from user actions. They can be used in order
+    //! to provide addition animations properly
+    Q_INVOKABLE void addToBeAddedLauncher(const QString &launcher);
+    Q_INVOKABLE void removeToBeAddedLauncher(const QString &launcher);
+    Q_INVOKABLE bool toBeAddedLauncherExists(const QString &launcher) const;
+
+    //! Launchers that are removed from user actions. They can be used in order
+    //! to provide removal animations properly
+    Q_INVOKABLE void addToBeRemovedLauncher(const QString &launcher);
+    Q_INVOKABLE void removeToBeRemovedLauncher(const QString &launcher);
+    Q_INVOKABLE bool isLauncherToBeRemoved(const QString &launcher) const;
+
+    //! Launchers that must be shown IMMEDIATELY after a window removal
+    //! because they are already present from a present libtaskmanager state
+    Q_INVOKABLE void addImmediateLauncher(const QString &launcher);
+    Q_INVOKABLE void removeImmediateLauncher(const QString &launcher);
+    Q_INVOKABLE bool immediateLauncherExists(const QString &launcher) const;
+
+    //! New launchers that must be moved in correct place
+    Q_INVOKABLE void addLauncherToBeMoved(const QString &launcher, const int pos);
+    Q_INVOKABLE void removeLauncherToBeMoved(const QString &launcher);
+    Q_INVOKABLE bool isLauncherToBeMoved(const QString &launcher) const;
+    Q_INVOKABLE int posOfLauncherToBeMoved(const QString &launcher) const;
+
+    //! Tasks that change state (launcher,startup,window) and at the next
+    //! state must look the same concerning the parabolic effect
+    Q_INVOKABLE void setFrozenTask(const QString &identifier, const qreal zoom);
+    Q_INVOKABLE void removeFrozenTask(const QString &identifier);
+    //! returns -1 when the task is not frozen
+    Q_INVOKABLE qreal frozenTaskZoom(const QString &identifier) const;
+
+signals:
+    void launchersToBeRemovedCountChanged();
+    void waitingLauncherRemoved(const QString &launcher);
+
+private slots:
+    void removeExpiredRecords();
+
+private:
+    struct MovedLauncherData {
+        int pos{0};
+        qint64 added{0};
+    };
+
+    struct FrozenTaskData {
+        qreal zoom{1.0};
+        qint64 added{0};
+    };
+
+    using LaunchersRecords = QHash<QString, qint64>;
+
+    void scheduleExpiry();
+
+    //! waiting and to be added launchers are matched when one contains the other,
+    //! exact matches are found directly and otherwise the oldest matching record is returned
+    static LaunchersRecords::const_iterator findMatching(const LaunchersRecords &records, const QString &launcher);
+    static bool matches(const QString &recorded, const QString &launcher);
+
+private:
+    static const int RECORDLIFETIME = 30 * 1000;
+
+    QElapsedTimer m_clock;
+    QTimer m_expiryTimer;
+
+    LaunchersRecords m_waitingLaunchers;
+    LaunchersRecords m_launchersToBeAdded;
+    LaunchersRecords m_launchersToBeRemoved;
+    LaunchersRecords m_immediateLaunchers;
+
+    QHash<QString, MovedLauncherData> m_launchersToBeMoved;
+    QHash<QString, FrozenTaskData> m_frozenTasks;
+};
+
+}
+}
+
+#endif
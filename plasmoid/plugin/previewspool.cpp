@@ -0,0 +1,360 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "previewspool.h"
+
+// C++
+#include <limits>
+
+// Qt
+#include <QDebug>
+#include <QQmlContext>
+#include <QQmlEngine>
+#include <QQuickWindow>
+
+namespace Latte {
+namespace Tasks {
+
+PreviewsPool::PreviewsPool(QObject *parent)
+    : QObject(parent)
+{
+    m_clock.start();
+
+    m_expiryTimer.setSingleShot(true);
+    connect(&m_expiryTimer, &QTimer::timeout, this, &PreviewsPool::removeExpiredThumbnails);
+}
+
+PreviewsPool::~PreviewsPool()
+{
+    for (auto &thumbnails : m_thumbnails) {
+        for (auto &data : thumbnails) {
+            delete data.item;
+        }
+    }
+}
+
+QQmlComponent *PreviewsPool::component() const
+{
+    return m_component;
+}
+
+void PreviewsPool::setComponent(QQmlComponent *component)
+{
+    if (m_component == component) {
+        return;
+    }
+
+    m_component = component;
+    //! thumbnails of the previous component must not be reused
+    m_generation++;
+    clear();
+    emit componentChanged();
+}
+
+QQuickItem *PreviewsPool::idleParent() const
+{
+    return m_idleParent;
+}
+
+void PreviewsPool::setIdleParent(QQuickItem *parent)
+{
+    if (m_idleParent == parent) {
+        return;
+    }
+
+    for (auto &thumbnails : m_thumbnails) {
+        for (auto &data : thumbnails) {
+            if (data.item && !data.holder) {
+                data.item->setParentItem(parent);
+            }
+        }
+    }
+
+    m_idleParent = parent;
+    emit idleParentChanged();
+}
+
+int PreviewsPool::keepAlive() const
+{
+    return m_keepAlive;
+}
+
+void PreviewsPool::setKeepAlive(int keepAlive)
+{
+    if (m_keepAlive == keepAlive) {
+        return;
+    }
+
+    m_keepAlive = qMax(0, keepAlive);
+    emit keepAliveChanged();
+}
+
+int PreviewsPool::streamsCount() const
+{
+    int streams{0};
+
+    for (const auto &thumbnails : m_thumbnails) {
+        streams += thumbnails.count();
+    }
+
+    return streams;
+}
+
+int PreviewsPool::activeStreamsCount() const
+{
+    int active{0};
+
+    for (const auto &thumbnails : m_thumbnails) {
+        for (const auto &data : thumbnails) {
+            if (data.holder) {
+                active++;
+            }
+        }
+    }
+
+    return active;
+}
+
+int PreviewsPool::createdStreamsCount() const
+{
+    return m_createdStreamsCount;
+}
+
+qint64 PreviewsPool::memoryUsage() const
+{
+    qint64 bytes{0};
+
+    for (const auto &thumbnails : m_thumbnails) {
+        for (const auto &data : thumbnails) {
+            if (!data.item) {
+                continue;
+            }
+
+            const qreal dpr = data.item->window() ? data.item->window()->effectiveDevicePixelRatio() : 1.0;
+            bytes += static_cast<qint64>(data.item->width() * dpr) * static_cast<qint64>(data.item->height() * dpr) * 4;
+        }
+    }
+
+    return bytes;
+}
+
+QString PreviewsPool::key(const QVariant &winId)
+{
+    return winId.toString();
+}
+
+QQuickItem *PreviewsPool::createThumbnail(const QVariant &winId)
+{
+    QQmlContext *context = m_component->creationContext() ? m_component->creationContext() : qmlContext(this);
+    QObject *object = m_component->beginCreate(context);
+
+    if (!object) {
+        qWarning() << "Previews pool, thumbnail could not be created :: " << m_component->errors();
+        return nullptr;
+    }
+
+    object->setProperty("winId", winId);
+    m_component->completeCreate();
+
+    QQuickItem *item = qobject_cast<QQuickItem *>(object);
+
+    if (!item) {
+        delete object;
+        return nullptr;
+    }
+
+    QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+    m_createdStreamsCount++;
+
+    return item;
+}
+
+void PreviewsPool::destroyThumbnail(ThumbnailData &data)
+{
+    if (data.item) {
+        data.item->setParentItem(nullptr);
+        data.item->deleteLater();
+        data.item.clear();
+    }
+}
+
+QQuickItem *PreviewsPool::acquire(const QVariant &winId, QQuickItem *holder)
+{
+    const QString winKey = key(winId);
+
+    if (!holder || !m_component || winKey.isEmpty()) {
+        return nullptr;
+    }
+
+    QList<ThumbnailData> &thumbnails = m_thumbnails[winKey];
+
+    for (auto &data : thumbnails) {
+        if (data.item && data.holder == holder) {
+            return data.item;
+        }
+    }
+
+    //! reuse an idle thumbnail of the current component
+    for (auto &data : thumbnails) {
+        if (data.item && !data.holder && data.generation == m_generation) {
+            data.holder = holder;
+            data.item->setParentItem(holder);
+
+            emit statisticsChanged();
+            return data.item;
+        }
+    }
+
+    QQuickItem *item = createThumbnail(winId);
+
+    if (!item) {
+        if (thumbnails.isEmpty()) {
+            m_thumbnails.remove(winKey);
+        }
+
+        return nullptr;
+    }
+
+    ThumbnailData data;
+    data.item = item;
+    data.holder = holder;
+    data.generation = m_generation;
+    thumbnails << data;
+
+    item->setParentItem(holder);
+
+    emit statisticsChanged();
+
+    return item;
+}
+
+void PreviewsPool::release(const QVariant &winId, QQuickItem *holder)
+{
+    auto thumbnails = m_thumbnails.find(key(winId));
+
+    if (thumbnails == m_thumbnails.end()) {
+        return;
+    }
+
+    for (int i=0; i<thumbnails.value().count(); ++i) {
+        ThumbnailData &data = thumbnails.value()[i];
+
+        if (data.holder != holder) {
+            continue;
+        }
+
+        if (!data.item || data.generation != m_generation) {
+            destroyThumbnail(data);
+            thumbnails.value().removeAt(i);
+        } else {
+            data.holder.clear();
+            data.item->setParentItem(m_idleParent);
+            data.released = m_clock.elapsed();
+            scheduleExpiry();
+        }
+
+        break;
+    }
+
+    if (thumbnails.value().isEmpty()) {
+        m_thumbnails.erase(thumbnails);
+    }
+
+    emit statisticsChanged();
+}
+
+void PreviewsPool::clear()
+{
+    bool removed{false};
+
+    for (auto it = m_thumbnails.begin(); it != m_thumbnails.end();) {
+        QList<ThumbnailData> &thumbnails = it.value();
+
+        for (int i=thumbnails.count()-1; i>=0; --i) {
+            if (!thumbnails[i].holder) {
+                destroyThumbnail(thumbnails[i]);
+                thumbnails.removeAt(i);
+                removed = true;
+            }
+        }
+
+        if (thumbnails.isEmpty()) {
+            it = m_thumbnails.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (removed) {
+        emit statisticsChanged();
+    }
+}
+
+void PreviewsPool::scheduleExpiry()
+{
+    if (!m_expiryTimer.isActive()) {
+        m_expiryTimer.start(m_keepAlive);
+    }
+}
+
+void PreviewsPool::removeExpiredThumbnails()
+{
+    const qint64 now = m_clock.elapsed();
+    const qint64 expired = now - m_keepAlive;
+    //! next expiry is scheduled for the oldest idle thumbnail that remains
+    qint64 oldest = std::numeric_limits<qint64>::max();
+    bool removed{false};
+
+    for (auto it = m_thumbnails.begin(); it != m_thumbnails.end();) {
+        QList<ThumbnailData> &thumbnails = it.value();
+
+        for (int i=thumbnails.count()-1; i>=0; --i) {
+            ThumbnailData &data = thumbnails[i];
+
+            if (data.holder) {
+                continue;
+            }
+
+            if (data.released <= expired) {
+                destroyThumbnail(data);
+                thumbnails.removeAt(i);
+                removed = true;
+            } else {
+                oldest = qMin(oldest, data.released);
+            }
+        }
+
+        if (thumbnails.isEmpty()) {
+            it = m_thumbnails.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (removed) {
+        emit statisticsChanged();
+    }
+
+    if (oldest != std::numeric_limits<qint64>::max()) {
+        m_expiryTimer.start(static_cast<int>(qMax<qint64>(0, oldest + m_keepAlive - now)));
+    }
+}
+
+}
+}
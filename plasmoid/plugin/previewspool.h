@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTETASKSPREVIEWSPOOL_H
+#define LATTETASKSPREVIEWSPOOL_H
+
+// Qt
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QQmlComponent>
+#include <QQuickItem>
+#include <QTimer>
+
+namespace Latte {
+namespace Tasks {
+
+//! Pool of window preview thumbnails. A thumbnail and its capture stream are
+//! kept alive for keepAlive ms after its preview released it and they are reused
+//! by the next preview of the same window. This way sweeping the mouse across
+//! tasks does not start and stop capture streams all the time. An item can be
+//! shown by one preview only, so a window that is shown by more previews at the
+//! same time gets a thumbnail for each one of them.
+class PreviewsPool : public QObject
+{
+    Q_OBJECT
+    //! component that creates thumbnails, it must provide a winId property
+    Q_PROPERTY(QQmlComponent *component READ component WRITE setComponent NOTIFY componentChanged)
+    //! idle thumbnails are kept alive under this item, it should not be painted
+    Q_PROPERTY(QQuickItem *idleParent READ idleParent WRITE setIdleParent NOTIFY idleParentChanged)
+    Q_PROPERTY(int keepAlive READ keepAlive WRITE setKeepAlive NOTIFY keepAliveChanged)
+
+    //! monitoring
+    Q_PROPERTY(int streamsCount READ streamsCount NOTIFY statisticsChanged)
+    Q_PROPERTY(int activeStreamsCount READ activeStreamsCount NOTIFY statisticsChanged)
+    Q_PROPERTY(int createdStreamsCount READ createdStreamsCount NOTIFY statisticsChanged)
+    //! estimation in bytes of the textures of all alive thumbnails
+    Q_PROPERTY(qint64 memoryUsage READ memoryUsage NOTIFY statisticsChanged)
+
+public:
+    PreviewsPool(QObject *parent = nullptr);
+    ~PreviewsPool() override;
+
+    QQmlComponent *component() const;
+    void setComponent(QQmlComponent *component);
+
+    QQuickItem *idleParent() const;
+    void setIdleParent(QQuickItem *parent);
+
+    int keepAlive() const;
+    void setKeepAlive(int keepAlive);
+
+    int streamsCount() const;
+    int activeStreamsCount() const;
+    int createdStreamsCount() const;
+    qint64 memoryUsage() const;
+
+    //! returns a thumbnail of the window reparented to holder
+    QQuickItem *acquire(const QVariant &winId, QQuickItem *holder);
+    void release(const QVariant &winId, QQuickItem *holder);
+
+    //! destroys all idle thumbnails, thumbnails in use are destroyed when they are released
+    Q_INVOKABLE void clear();
+
+signals:
+    void componentChanged();
+    void idleParentChanged();
+    void keepAliveChanged();
+    void statisticsChanged();
+
+private slots:
+    void removeExpiredThumbnails();
+
+private:
+    struct ThumbnailData {
+        QPointer<QQuickItem> item;
+        //! preview that shows the thumbnail, it is null for idle thumbnails
+        QPointer<QQuickItem> holder;
+        //! component generation the thumbnail was created from
+        int generation{0};
+        qint64 released{0};
+    };
+
+    QQuickItem *createThumbnail(const QVariant &winId);
+    void destroyThumbnail(ThumbnailData &data);
+    void scheduleExpiry();
+
+    static QString key(const QVariant &winId);
+
+private:
+    static const int DEFAULTKEEPALIVE = 3000;
+
+    int m_keepAlive{DEFAULTKEEPALIVE};
+    int m_createdStreamsCount{0};
+    //! increased when the component changes, older thumbnails are never reused
+    int m_generation{0};
+
+    QPointer<QQmlComponent> m_component;
+    QPointer<QQuickItem> m_idleParent;
+
+    QElapsedTimer m_clock;
+    QTimer m_expiryTimer;
+
+    //! window, thumbnails of that window
+    QHash<QString, QList<ThumbnailData>> m_thumbnails;
+};
+
+}
+}
+
+#endif
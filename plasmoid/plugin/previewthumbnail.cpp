@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "previewthumbnail.h"
+
+// local
+#include "previewspool.h"
+
+namespace Latte {
+namespace Tasks {
+
+PreviewThumbnail::PreviewThumbnail(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+}
+
+PreviewThumbnail::~PreviewThumbnail()
+{
+    releaseThumbnail();
+}
+
+QObject *PreviewThumbnail::pool() const
+{
+    return m_pool;
+}
+
+void PreviewThumbnail::setPool(QObject *pool)
+{
+    PreviewsPool *previewsPool = qobject_cast<PreviewsPool *>(pool);
+
+    if (m_pool == previewsPool) {
+        return;
+    }
+
+    releaseThumbnail();
+    m_pool = previewsPool;
+    acquireThumbnail();
+
+    emit poolChanged();
+}
+
+QVariant PreviewThumbnail::winId() const
+{
+    return m_winId;
+}
+
+void PreviewThumbnail::setWinId(const QVariant &winId)
+{
+    if (m_winId == winId) {
+        return;
+    }
+
+    m_winId = winId;
+
+    releaseThumbnail();
+    acquireThumbnail();
+
+    emit winIdChanged();
+}
+
+QQuickItem *PreviewThumbnail::thumbnail() const
+{
+    return m_thumbnail;
+}
+
+bool PreviewThumbnail::isValidWinId(const QVariant &winId)
+{
+    if (!winId.isValid() || winId.isNull()) {
+        return false;
+    }
+
+    const QString id = winId.toString();
+    return !id.isEmpty() && id != QLatin1String("0");
+}
+
+void PreviewThumbnail::acquireThumbnail()
+{
+    if (!m_pool || !isValidWinId(m_winId)) {
+        return;
+    }
+
+    m_thumbnail = m_pool->acquire(m_winId, this);
+
+    if (m_thumbnail) {
+        m_acquiredWinId = m_winId;
+        updateThumbnailGeometry();
+        emit thumbnailChanged();
+    }
+}
+
+void PreviewThumbnail::releaseThumbnail()
+{
+    if (!m_acquiredWinId.isValid()) {
+        return;
+    }
+
+    if (m_pool) {
+        m_pool->release(m_acquiredWinId, this);
+    }
+
+    m_acquiredWinId = QVariant();
+    m_thumbnail.clear();
+    emit thumbnailChanged();
+}
+
+void PreviewThumbnail::updateThumbnailGeometry()
+{
+    if (!m_thumbnail) {
+        return;
+    }
+
+    m_thumbnail->setPosition(QPointF(0, 0));
+    m_thumbnail->setSize(size());
+}
+
+void PreviewThumbnail::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+
+    if (newGeometry.size() != oldGeometry.size()) {
+        updateThumbnailGeometry();
+    }
+}
+
+}
+}
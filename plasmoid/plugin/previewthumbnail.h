@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTETASKSPREVIEWTHUMBNAIL_H
+#define LATTETASKSPREVIEWTHUMBNAIL_H
+
+// Qt
+#include <QPointer>
+#include <QQuickItem>
+#include <QVariant>
+
+namespace Latte {
+namespace Tasks {
+
+class PreviewsPool;
+
+//! Holder of a window thumbnail that is provided by a PreviewsPool. The
+//! thumbnail is acquired when winId is set and released back to the pool
+//! when winId changes or the holder is destroyed.
+class PreviewThumbnail : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QObject *pool READ pool WRITE setPool NOTIFY poolChanged)
+    Q_PROPERTY(QVariant winId READ winId WRITE setWinId NOTIFY winIdChanged)
+
+    Q_PROPERTY(QQuickItem *thumbnail READ thumbnail NOTIFY thumbnailChanged)
+
+public:
+    PreviewThumbnail(QQuickItem *parent = nullptr);
+    ~PreviewThumbnail() override;
+
+    QObject *pool() const;
+    void setPool(QObject *pool);
+
+    QVariant winId() const;
+    void setWinId(const QVariant &winId);
+
+    QQuickItem *thumbnail() const;
+
+signals:
+    void poolChanged();
+    void thumbnailChanged();
+    void winIdChanged();
+
+protected:
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private:
+    void acquireThumbnail();
+    void releaseThumbnail();
+    void updateThumbnailGeometry();
+
+    static bool isValidWinId(const QVariant &winId);
+
+private:
+    QVariant m_winId;
+    //! window whose thumbnail is currently held
+    QVariant m_acquiredWinId;
+
+    QPointer<PreviewsPool> m_pool;
+    QPointer<QQuickItem> m_thumbnail;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "taskaudiostreams.h"
+
+// local
+#include "audiostreamsindex.h"
+
+namespace Latte {
+namespace Tasks {
+
+TaskAudioStreams::TaskAudioStreams(QObject *parent)
+    : QObject(parent)
+{
+}
+
+TaskAudioStreams::~TaskAudioStreams()
+{
+    if (m_index) {
+        if (!m_registeredAppWindow.isEmpty()) {
+            m_index->removeAppWindow(m_registeredAppWindow);
+        }
+
+        m_index->unsubscribe(this);
+    }
+}
+
+QObject *TaskAudioStreams::index() const
+{
+    return m_index;
+}
+
+void TaskAudioStreams::setIndex(QObject *index)
+{
+    AudioStreamsIndex *streamsIndex = qobject_cast<AudioStreamsIndex *>(index);
+
+    if (m_index == streamsIndex) {
+        return;
+    }
+
+    if (m_index) {
+        if (!m_registeredAppWindow.isEmpty()) {
+            m_index->removeAppWindow(m_registeredAppWindow);
+            m_registeredAppWindow.clear();
+        }
+
+        m_index->unsubscribe(this);
+    }
+
+    m_index = streamsIndex;
+
+    updateAppWindow();
+    updateSubscription();
+    emit indexChanged();
+}
+
+bool TaskAudioStreams::enabled() const
+{
+    return m_enabled;
+}
+
+void TaskAudioStreams::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled) {
+        return;
+    }
+
+    m_enabled = enabled;
+    updateStreams();
+    emit enabledChanged();
+}
+
+bool TaskAudioStreams::isWindow() const
+{
+    return m_isWindow;
+}
+
+void TaskAudioStreams::setIsWindow(bool isWindow)
+{
+    if (m_isWindow == isWindow) {
+        return;
+    }
+
+    m_isWindow = isWindow;
+    updateAppWindow();
+    emit isWindowChanged();
+}
+
+int TaskAudioStreams::pid() const
+{
+    return m_pid;
+}
+
+void TaskAudioStreams::setPid(int pid)
+{
+    if (m_pid == pid) {
+        return;
+    }
+
+    m_pid = pid;
+    updateSubscription();
+    emit pidChanged();
+}
+
+QString TaskAudioStreams::appName() const
+{
+    return m_appName;
+}
+
+void TaskAudioStreams::setAppName(const QString &name)
+{
+    if (m_appName == name) {
+        return;
+    }
+
+    m_appName = name;
+    updateAppWindow();
+    updateSubscription();
+    emit appNameChanged();
+}
+
+QString TaskAudioStreams::launcherName() const
+{
+    return m_launcherName;
+}
+
+void TaskAudioStreams::setLauncherName(const QString &name)
+{
+    if (m_launcherName == name) {
+        return;
+    }
+
+    m_launcherName = name;
+    updateSubscription();
+    emit launcherNameChanged();
+}
+
+QVariantList TaskAudioStreams::streams() const
+{
+    QVariantList streams;
+
+    for (const auto &stream : m_streams) {
+        if (stream) {
+            streams << QVariant::fromValue(stream.data());
+        }
+    }
+
+    return streams;
+}
+
+void TaskAudioStreams::updateAppWindow()
+{
+    const QString appWindow = (m_index && m_isWindow) ? m_appName : QString();
+
+    if (m_registeredAppWindow == appWindow) {
+        return;
+    }
+
+    //! the new window is registered first in order to not evict
+    //! the pid match of an application that is still open
+    if (!appWindow.isEmpty()) {
+        m_index->addAppWindow(appWindow);
+    }
+
+    if (m_index && !m_registeredAppWindow.isEmpty()) {
+        m_index->removeAppWindow(m_registeredAppWindow);
+    }
+
+    m_registeredAppWindow = appWindow;
+}
+
+void TaskAudioStreams::updateSubscription()
+{
+    if (m_index) {
+        m_index->subscribe(this, m_pid, {m_appName, m_launcherName});
+    }
+
+    updateStreams();
+}
+
+void TaskAudioStreams::updateStreams()
+{
+    QList<QObject *> indexed;
+
+    if (m_index && m_enabled) {
+        indexed = m_index->streamsForPid(m_pid);
+
+        if (!indexed.isEmpty()) {
+            m_index->registerPidMatch(m_appName);
+        } else if (!m_index->hasPidMatch(m_appName)) {
+            //! We only want to fall back to appName matching if we never managed to map
+            //! a PID to an audio stream window. Otherwise if you have two instances of
+            //! an application, one playing and the other not, it will look up appName
+            //! for the non-playing instance and erroneously show an indicator on both.
+            indexed = m_index->streamsForAppName(m_appName);
+
+            if (indexed.isEmpty() && !m_launcherName.isEmpty()) {
+                indexed = m_index->streamsForAppName(m_launcherName);
+            }
+        }
+    }
+
+    QList<QPointer<QObject>> streams;
+
+    for (auto *stream : indexed) {
+        streams << stream;
+    }
+
+    //! streams are published only when they have changed in order
+    //! to avoid binding loops
+    if (m_streams == streams) {
+        return;
+    }
+
+    m_streams = streams;
+    emit streamsChanged();
+}
+
+void TaskAudioStreams::indexDestroyed()
+{
+    m_index.clear();
+    m_registeredAppWindow.clear();
+
+    if (!m_streams.isEmpty()) {
+        m_streams.clear();
+        emit streamsChanged();
+    }
+}
+
+}
+}
@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2021  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ *  This file is part of Latte-Dock
+ *
+ *  Latte-Dock is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License as
+ *  published by the Free Software Foundation; either version 2 of
+ *  the License, or (at your option) any later version.
+ *
+ *  Latte-Dock is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATTETASKSTASKAUDIOSTREAMS_H
+#define LATTETASKSTASKAUDIOSTREAMS_H
+
+// Qt
+#include <QObject>
+#include <QPointer>
+#include <QVariantList>
+
+namespace Latte {
+namespace Tasks {
+class AudioStreamsIndex;
+}
+}
+
+namespace Latte {
+namespace Tasks {
+
+//! The audio streams of a task, they are updated from AudioStreamsIndex
+//! only when streams of the task pid or application names change
+class TaskAudioStreams : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QObject *index READ index WRITE setIndex NOTIFY indexChanged)
+
+    //! when disabled no streams are provided, e.g. during tasks dragging
+    Q_PROPERTY(bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged)
+    //! windows keep the pid matches of their application alive
+    Q_PROPERTY(bool isWindow READ isWindow WRITE setIsWindow NOTIFY isWindowChanged)
+
+    Q_PROPERTY(int pid READ pid WRITE setPid NOTIFY pidChanged)
+    Q_PROPERTY(QString appName READ appName WRITE setAppName NOTIFY appNameChanged)
+    Q_PROPERTY(QString launcherName READ launcherName WRITE setLauncherName NOTIFY launcherNameChanged)
+
+    Q_PROPERTY(QVariantList streams READ streams NOTIFY streamsChanged)
+
+public:
+    TaskAudioStreams(QObject *parent = nullptr);
+    ~TaskAudioStreams() override;
+
+    QObject *index() const;
+    void setIndex(QObject *index);
+
+    bool enabled() const;
+    void setEnabled(bool enabled);
+
+    bool isWindow() const;
+    void setIsWindow(bool isWindow);
+
+    int pid() const;
+    void setPid(int pid);
+
+    QString appName() const;
+    void setAppName(const QString &name);
+
+    QString launcherName() const;
+    void setLauncherName(const QString &name);
+
+    QVariantList streams() const;
+
+    void updateStreams();
+    void indexDestroyed();
+
+signals:
+    void appNameChanged();
+    void enabledChanged();
+    void indexChanged();
+    void isWindowChanged();
+    void launcherNameChanged();
+    void pidChanged();
+    void streamsChanged();
+
+private:
+    void updateAppWindow();
+    void updateSubscription();
+
+private:
+    bool m_enabled{true};
+    bool m_isWindow{false};
+
+    int m_pid{-1};
+
+    QString m_appName;
+    QString m_launcherName;
+    //! application name that is registered as an open window in the index
+    QString m_registeredAppWindow;
+
+    //! streams are deleted from their Instantiator before the index updates its subscribers
+    QList<QPointer<QObject>> m_streams;
+
+    QPointer<AudioStreamsIndex> m_index;
+};
+
+}
+}
+
+#endif
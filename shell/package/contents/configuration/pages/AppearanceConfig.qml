@@ -931,7 +931,7 @@ PlasmaComponents.Page {
                 RowLayout {
                     Layout.minimumWidth: dialog.optionsWidth
                     Layout.maximumWidth: Layout.minimumWidth
-                    visible: dialog.advancedLevel && dialog.kirigamiLibraryIsFound
+                    visible: dialog.advancedLevel
 
                     PlasmaComponents.Label {
                         text: i18n("Radius")
@@ -974,7 +974,7 @@ PlasmaComponents.Page {
                     Layout.minimumWidth: dialog.optionsWidth
                     Layout.maximumWidth: Layout.minimumWidth
                     enabled: LatteCore.WindowSystem.compositingActive
-                    visible: dialog.advancedLevel && dialog.kirigamiLibraryIsFound
+                    visible: dialog.advancedLevel
 
                     PlasmaComponents.Label {
                         text: i18n("Shadow")